@@ -0,0 +1,52 @@
+#include <SFML/Audio/InputSoundFile.hpp>
+
+#include <Benchmark.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+// Decode a whole file per iteration, opening included
+void decode(sfbench::State& state, const std::string& filename)
+{
+    sf::InputSoundFile file;
+    if (!file.openFromFile(sfbench::getResourcePath(filename)))
+    {
+        state.skip("cannot open " + filename);
+        return;
+    }
+
+    state.setBytesPerIteration(file.getSampleCount() * sizeof(std::int16_t));
+
+    std::vector<std::int16_t> samples(4096);
+    while (state.keepRunning())
+    {
+        if (!file.openFromFile(sfbench::getResourcePath(filename)))
+            return;
+
+        while (file.read(samples.data(), samples.size()) > 0)
+            sfbench::doNotOptimize(samples.data());
+    }
+}
+} // namespace
+
+SFML_BENCHMARK(InputSoundFile_decodeWav)
+{
+    decode(state, "sound/resources/killdeer.wav");
+}
+
+SFML_BENCHMARK(InputSoundFile_decodeOgg)
+{
+    decode(state, "sound/resources/doodle_pop.ogg");
+}
+
+SFML_BENCHMARK(InputSoundFile_decodeFlac)
+{
+    decode(state, "sound/resources/ding.flac");
+}
+
+SFML_BENCHMARK(InputSoundFile_decodeMp3)
+{
+    decode(state, "sound/resources/ding.mp3");
+}
@@ -0,0 +1,193 @@
+#include <Benchmark.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct Entry
+{
+    const char*          name;
+    sfbench::Function    function;
+    sfbench::Requirement requirement;
+};
+
+std::vector<Entry>& getRegistry()
+{
+    static std::vector<Entry> registry;
+    return registry;
+}
+
+struct Options
+{
+    std::string               filter;
+    std::string               output;
+    std::chrono::milliseconds minTime{500};
+    bool                      noContext{false};
+    bool                      list{false};
+};
+
+void printUsage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --filter <text>    Only run the benchmarks whose name contains <text>\n"
+              << "  --output <file>    Write the JSON results to <file> instead of the standard output\n"
+              << "  --min-time <ms>    Minimum measured time of each benchmark (default: 500)\n"
+              << "  --no-context       Skip the benchmarks that need an OpenGL context\n"
+              << "  --list             List the benchmarks and exit\n";
+}
+
+bool parseOptions(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const bool        hasValue = i + 1 < argc;
+
+        if (argument == "--filter" && hasValue)
+            options.filter = argv[++i];
+        else if (argument == "--output" && hasValue)
+            options.output = argv[++i];
+        else if (argument == "--min-time" && hasValue)
+            options.minTime = std::chrono::milliseconds(std::stoll(argv[++i]));
+        else if (argument == "--no-context")
+            options.noContext = true;
+        else if (argument == "--list")
+            options.list = true;
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Run a benchmark with more and more iterations, until it lasts long enough to be measured reliably
+sfbench::State run(const Entry& entry, std::chrono::nanoseconds minTime)
+{
+    std::uint64_t iterations = 1;
+
+    for (;;)
+    {
+        sfbench::State state(iterations);
+        entry.function(state);
+
+        const auto elapsed = state.getElapsedTime();
+        if (!state.getSkipReason().empty() || (elapsed >= minTime) || (iterations >= 1'000'000'000))
+            return state;
+
+        // Aim directly for the minimum time, growing by at most 10x at once
+        const double ratio = elapsed.count() > 0
+                                 ? static_cast<double>(minTime.count()) / static_cast<double>(elapsed.count())
+                                 : 10.0;
+        iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * std::clamp(ratio * 1.2, 2.0, 10.0));
+    }
+}
+
+void writeResult(std::ostream& stream, const char* name, const sfbench::State& state)
+{
+    stream << "    {\"name\": \"" << name << '"';
+
+    if (!state.getSkipReason().empty())
+    {
+        stream << ", \"skipped\": \"" << state.getSkipReason() << "\"}";
+        return;
+    }
+
+    const auto   iterations = state.getIterations();
+    const double seconds    = std::chrono::duration<double>(state.getElapsedTime()).count();
+
+    stream << ", \"iterations\": " << iterations << ", \"ns_per_iteration\": "
+           << static_cast<double>(state.getElapsedTime().count()) / static_cast<double>(iterations);
+
+    if (state.getBytesPerIteration())
+        stream << ", \"bytes_per_second\": "
+               << static_cast<double>(state.getBytesPerIteration() * iterations) / seconds;
+
+    if (state.getItemsPerIteration())
+        stream << ", \"items_per_second\": "
+               << static_cast<double>(state.getItemsPerIteration() * iterations) / seconds;
+
+    stream << '}';
+}
+} // namespace
+
+namespace sfbench
+{
+bool registerBenchmark(const char* name, Function function, Requirement requirement)
+{
+    getRegistry().push_back({name, function, requirement});
+    return true;
+}
+
+std::string getResourcePath(const std::string& filename)
+{
+    return std::string(SFML_BENCHMARK_RESOURCES_DIR) + '/' + filename;
+}
+} // namespace sfbench
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    auto& registry = getRegistry();
+    std::sort(registry.begin(),
+              registry.end(),
+              [](const Entry& a, const Entry& b) { return std::strcmp(a.name, b.name) < 0; });
+
+    if (options.list)
+    {
+        for (const Entry& entry : registry)
+            std::cout << entry.name << '\n';
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream file;
+    if (!options.output.empty())
+    {
+        file.open(options.output);
+        if (!file)
+        {
+            std::cerr << "Failed to open " << options.output << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::ostream& output = options.output.empty() ? std::cout : file;
+    output << std::setprecision(6) << "{\n  \"benchmarks\": [";
+
+    const char* separator = "\n";
+    for (const Entry& entry : registry)
+    {
+        if (std::strstr(entry.name, options.filter.c_str()) == nullptr)
+            continue;
+
+        sfbench::State state(0);
+        if (options.noContext && (entry.requirement == sfbench::Requirement::Context))
+            state.skip("no context");
+        else
+            state = run(entry, options.minTime);
+
+        // Progress goes to the error stream, so that the results can be piped
+        const std::string status = state.getSkipReason().empty() ? "done" : "skipped, " + state.getSkipReason();
+        std::cerr << entry.name << ": " << status << std::endl;
+
+        output << separator;
+        writeResult(output, entry.name, state);
+        separator = ",\n";
+    }
+
+    output << "\n  ]\n}\n";
+    return EXIT_SUCCESS;
+}
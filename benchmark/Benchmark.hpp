@@ -0,0 +1,135 @@
+#pragma once
+
+// Minimal benchmark harness, so that benchmarks don't need any external dependency
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace sfbench
+{
+////////////////////////////////////////////////////////////
+/// Timing state of a running benchmark
+///
+/// The benchmark body is a loop on keepRunning(): the clock
+/// starts on the first call, and stops when the number of
+/// iterations chosen by the runner is reached.
+////////////////////////////////////////////////////////////
+class State
+{
+public:
+    explicit State(std::uint64_t iterations) : m_iterations(iterations)
+    {
+    }
+
+    bool keepRunning()
+    {
+        if (m_remaining == m_iterations)
+            m_start = std::chrono::steady_clock::now();
+
+        if (m_remaining == 0)
+        {
+            m_elapsed = std::chrono::steady_clock::now() - m_start;
+            return false;
+        }
+
+        --m_remaining;
+        return true;
+    }
+
+    // Amount of data processed by one iteration, reported as a throughput
+    void setBytesPerIteration(std::uint64_t bytes)
+    {
+        m_bytesPerIteration = bytes;
+    }
+
+    // Number of items (vertices, characters, ...) processed by one iteration
+    void setItemsPerIteration(std::uint64_t items)
+    {
+        m_itemsPerIteration = items;
+    }
+
+    // Give up, for example when a resource or a context is not available
+    void skip(std::string reason)
+    {
+        m_skipReason = std::move(reason);
+    }
+
+    std::uint64_t getIterations() const
+    {
+        return m_iterations;
+    }
+
+    std::chrono::nanoseconds getElapsedTime() const
+    {
+        return m_elapsed;
+    }
+
+    std::uint64_t getBytesPerIteration() const
+    {
+        return m_bytesPerIteration;
+    }
+
+    std::uint64_t getItemsPerIteration() const
+    {
+        return m_itemsPerIteration;
+    }
+
+    const std::string& getSkipReason() const
+    {
+        return m_skipReason;
+    }
+
+private:
+    std::uint64_t                         m_iterations;
+    std::uint64_t                         m_remaining{m_iterations};
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::nanoseconds              m_elapsed{0};
+    std::uint64_t                         m_bytesPerIteration{0};
+    std::uint64_t                         m_itemsPerIteration{0};
+    std::string                           m_skipReason;
+};
+
+using Function = void (*)(State&);
+
+// Requirements of a benchmark, checked against the command line
+enum class Requirement
+{
+    None,
+    Context //!< Needs an OpenGL context, skipped with --no-context
+};
+
+bool registerBenchmark(const char* name, Function function, Requirement requirement);
+
+// Directory of the resources (fonts, sounds, images) used by the benchmarks
+std::string getResourcePath(const std::string& filename);
+
+// Prevent the compiler from optimizing away a computed value
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#endif
+}
+} // namespace sfbench
+
+#define SFML_BENCHMARK_IMPL(name, requirement)                                                 \
+    static void       name(sfbench::State& state);                                             \
+    static const bool name##Registered = sfbench::registerBenchmark(#name, name, requirement); \
+    static void       name(sfbench::State& state)
+
+// Define a benchmark
+#define SFML_BENCHMARK(name) SFML_BENCHMARK_IMPL(name, sfbench::Requirement::None)
+
+// Define a benchmark that needs an OpenGL context
+#define SFML_BENCHMARK_WITH_CONTEXT(name) SFML_BENCHMARK_IMPL(name, sfbench::Requirement::Context)
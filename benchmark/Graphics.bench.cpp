@@ -0,0 +1,183 @@
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <Benchmark.hpp>
+
+#include <string>
+#include <vector>
+
+SFML_BENCHMARK(Transform_combine)
+{
+    sf::Transform transform;
+    sf::Transform other;
+    other.translate({1.f, 2.f}).rotate(sf::degrees(0.01f)).scale({1.0001f, 0.9999f});
+
+    while (state.keepRunning())
+    {
+        transform.combine(other);
+        sfbench::doNotOptimize(transform);
+    }
+}
+
+SFML_BENCHMARK(Transform_transformPoint)
+{
+    const sf::Transform transform = sf::Transform().translate({10.f, 20.f}).rotate(sf::degrees(30.f)).scale({2.f, 3.f});
+    std::vector<sf::Vector2f> points(1024);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        points[i] = {static_cast<float>(i), static_cast<float>(i) * 0.5f};
+
+    state.setItemsPerIteration(points.size());
+
+    while (state.keepRunning())
+    {
+        for (sf::Vector2f& point : points)
+            point = transform.transformPoint(point);
+        sfbench::doNotOptimize(points.data());
+    }
+}
+
+SFML_BENCHMARK(Transform_transformPoints)
+{
+    const sf::Transform transform = sf::Transform().translate({10.f, 20.f}).rotate(sf::degrees(30.f)).scale({2.f, 3.f});
+    std::vector<sf::Vertex> vertices(1024);
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+        vertices[i].position = {static_cast<float>(i), static_cast<float>(i) * 0.5f};
+
+    state.setItemsPerIteration(vertices.size());
+
+    while (state.keepRunning())
+    {
+        transform.transformPoints(vertices.data(), vertices.size(), vertices.data());
+        sfbench::doNotOptimize(vertices.data());
+    }
+}
+
+SFML_BENCHMARK(Image_copy)
+{
+    sf::Image source;
+    source.create({512, 512}, sf::Color::Red);
+    sf::Image destination;
+    destination.create({1024, 1024});
+
+    state.setBytesPerIteration(512 * 512 * 4);
+
+    while (state.keepRunning())
+    {
+        const bool copied = destination.copy(source, {256, 256});
+        sfbench::doNotOptimize(copied);
+    }
+}
+
+SFML_BENCHMARK(Image_copyWithAlpha)
+{
+    sf::Image source;
+    source.create({512, 512}, sf::Color(255, 0, 0, 128));
+    sf::Image destination;
+    destination.create({1024, 1024});
+
+    state.setBytesPerIteration(512 * 512 * 4);
+
+    while (state.keepRunning())
+    {
+        const bool copied = destination.copy(source, {256, 256}, sf::IntRect({0, 0}, {0, 0}), true);
+        sfbench::doNotOptimize(copied);
+    }
+}
+
+SFML_BENCHMARK_WITH_CONTEXT(Font_getGlyph)
+{
+    sf::Font font;
+    if (!font.loadFromFile(sfbench::getResourcePath("shader/resources/tuffy.ttf")))
+    {
+        state.skip("cannot open tuffy.ttf");
+        return;
+    }
+
+    // Measure the cached lookup, glyphs are rendered once before the timing starts
+    for (std::uint32_t codePoint = 32; codePoint < 127; ++codePoint)
+        font.getGlyph(codePoint, 30, false);
+
+    state.setItemsPerIteration(127 - 32);
+
+    while (state.keepRunning())
+    {
+        for (std::uint32_t codePoint = 32; codePoint < 127; ++codePoint)
+            sfbench::doNotOptimize(font.getGlyph(codePoint, 30, false));
+    }
+}
+
+SFML_BENCHMARK_WITH_CONTEXT(Text_layout)
+{
+    sf::Font font;
+    if (!font.loadFromFile(sfbench::getResourcePath("shader/resources/tuffy.ttf")))
+    {
+        state.skip("cannot open tuffy.ttf");
+        return;
+    }
+
+    const std::string lorem = "Lorem ipsum dolor sit amet, consectetur adipiscing elit,\n"
+                              "sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\n";
+    const std::string strings[] = {lorem, lorem + lorem};
+
+    sf::Text text(strings[0], font);
+    text.setOutlineThickness(1.f);
+    state.setItemsPerIteration(strings[0].size());
+
+    std::size_t i = 0;
+    while (state.keepRunning())
+    {
+        // Alternate the strings, so that the geometry is rebuilt at each iteration
+        text.setString(strings[i++ % 2]);
+        sfbench::doNotOptimize(text.getLocalBounds());
+    }
+}
+
+SFML_BENCHMARK_WITH_CONTEXT(RenderTarget_drawShapes)
+{
+    sf::RenderTexture target;
+    if (!target.create({512, 512}))
+    {
+        state.skip("cannot create render texture");
+        return;
+    }
+
+    sf::RectangleShape shape({8.f, 8.f});
+    state.setItemsPerIteration(1000);
+
+    while (state.keepRunning())
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            shape.setPosition({static_cast<float>(i % 64) * 8.f, static_cast<float>(i / 64) * 8.f});
+            target.draw(shape);
+        }
+    }
+
+    target.display();
+}
+
+SFML_BENCHMARK_WITH_CONTEXT(RenderTarget_drawVertexArray)
+{
+    sf::RenderTexture target;
+    if (!target.create({512, 512}))
+    {
+        state.skip("cannot create render texture");
+        return;
+    }
+
+    sf::VertexArray vertices(sf::PrimitiveType::Triangles, 30000);
+    for (std::size_t i = 0; i < vertices.getVertexCount(); ++i)
+        vertices[i].position = {static_cast<float>(i % 512), static_cast<float>((i * 7) % 512)};
+
+    state.setItemsPerIteration(vertices.getVertexCount());
+
+    while (state.keepRunning())
+        target.draw(vertices);
+
+    target.display();
+}
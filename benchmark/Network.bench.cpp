@@ -0,0 +1,31 @@
+#include <SFML/Network/Packet.hpp>
+
+#include <Benchmark.hpp>
+
+#include <string>
+
+SFML_BENCHMARK(Packet_roundTrip)
+{
+    const std::string text = "The quick brown fox jumps over the lazy dog";
+    state.setItemsPerIteration(64 * 4);
+
+    sf::Packet packet;
+    while (state.keepRunning())
+    {
+        packet.clear();
+        for (std::int32_t i = 0; i < 64; ++i)
+            packet << i << static_cast<float>(i) * 0.5f << static_cast<std::uint64_t>(i) << text;
+
+        std::int32_t  integer = 0;
+        float         real    = 0.f;
+        std::uint64_t large   = 0;
+        std::string   string;
+        for (int i = 0; i < 64; ++i)
+            packet >> integer >> real >> large >> string;
+
+        sfbench::doNotOptimize(integer);
+        sfbench::doNotOptimize(real);
+        sfbench::doNotOptimize(large);
+        sfbench::doNotOptimize(string);
+    }
+}
@@ -0,0 +1,90 @@
+#include <SFML/System/String.hpp>
+#include <SFML/System/Utf.hpp>
+
+#include <Benchmark.hpp>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Mix of 1, 2, 3 and 4 bytes UTF-8 sequences
+std::string makeUtf8Text()
+{
+    std::string text;
+    for (int i = 0; i < 256; ++i)
+        text += "SFML \xC3\xA9t\xC3\xA9 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x8E\xAE\n";
+    return text;
+}
+} // namespace
+
+SFML_BENCHMARK(String_fromUtf8)
+{
+    const std::string text = makeUtf8Text();
+    state.setBytesPerIteration(text.size());
+
+    while (state.keepRunning())
+    {
+        const sf::String string = sf::String::fromUtf8(text.begin(), text.end());
+        sfbench::doNotOptimize(string);
+    }
+}
+
+SFML_BENCHMARK(String_toUtf8)
+{
+    const std::string text   = makeUtf8Text();
+    const sf::String  string = sf::String::fromUtf8(text.begin(), text.end());
+    state.setBytesPerIteration(text.size());
+
+    while (state.keepRunning())
+    {
+        const auto utf8 = string.toUtf8();
+        sfbench::doNotOptimize(utf8);
+    }
+}
+
+SFML_BENCHMARK(String_toAnsiString)
+{
+    const std::string text(4096, 'x');
+    const sf::String  string(text);
+    state.setItemsPerIteration(text.size());
+
+    while (state.keepRunning())
+    {
+        const std::string ansi = string.toAnsiString();
+        sfbench::doNotOptimize(ansi);
+    }
+}
+
+SFML_BENCHMARK(Utf8_toUtf32)
+{
+    const std::string          text = makeUtf8Text();
+    std::vector<std::uint32_t> output;
+    output.reserve(text.size());
+    state.setBytesPerIteration(text.size());
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        sf::Utf8::toUtf32(text.begin(), text.end(), std::back_inserter(output));
+        sfbench::doNotOptimize(output.data());
+    }
+}
+
+SFML_BENCHMARK(Utf32_toUtf16)
+{
+    const std::string          text = makeUtf8Text();
+    std::vector<std::uint32_t> input;
+    sf::Utf8::toUtf32(text.begin(), text.end(), std::back_inserter(input));
+    std::vector<std::uint16_t> output;
+    output.reserve(input.size() * 2);
+    state.setItemsPerIteration(input.size());
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        sf::Utf32::toUtf16(input.begin(), input.end(), std::back_inserter(output));
+        sfbench::doNotOptimize(output.data());
+    }
+}
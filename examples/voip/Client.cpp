@@ -5,7 +5,10 @@
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 
 const std::uint8_t clientAudioData   = 1;
@@ -16,7 +19,7 @@ const std::uint8_t clientEndOfStream = 2;
 /// Specialization of audio recorder for sending recorded audio
 /// data through the network
 ////////////////////////////////////////////////////////////
-class NetworkRecorder : public sf::SoundRecorder
+class NetworkRecorder : public sf::QueuedSoundRecorder
 {
 public:
     ////////////////////////////////////////////////////////////
@@ -28,6 +31,8 @@ public:
     ////////////////////////////////////////////////////////////
     NetworkRecorder(const sf::IpAddress& host, unsigned short port) : m_host(host), m_port(port)
     {
+        // Capture small chunks often to keep the latency low
+        setProcessingInterval(sf::milliseconds(10));
     }
 
     ////////////////////////////////////////////////////////////
@@ -49,30 +54,53 @@ private:
     ////////////////////////////////////////////////////////////
     bool onStart() override
     {
-        if (m_socket.connect(m_host, m_port) == sf::Socket::Status::Done)
-        {
-            std::cout << "Connected to server " << m_host << std::endl;
-            return true;
-        }
-        else
-        {
+        // Let the base class allocate its queue
+        if (!sf::QueuedSoundRecorder::onStart())
             return false;
-        }
+
+        if (m_socket.connect(m_host, m_port) != sf::Socket::Status::Done)
+            return false;
+
+        std::cout << "Connected to server " << m_host << std::endl;
+
+        // Send the audio data from a separate thread, so that a slow network never delays the capture
+        m_sending = true;
+        m_sender  = std::thread(&NetworkRecorder::send, this);
+        return true;
     }
 
     ////////////////////////////////////////////////////////////
-    /// \see SoundRecorder::onProcessSamples
+    /// Send the captured audio data until the capture stops
     ///
     ////////////////////////////////////////////////////////////
-    bool onProcessSamples(const std::int16_t* samples, std::size_t sampleCount) override
+    void send()
     {
-        // Pack the audio samples into a network packet
-        sf::Packet packet;
-        packet << clientAudioData;
-        packet.append(samples, sampleCount * sizeof(std::int16_t));
+        std::vector<std::int16_t> samples(4096);
 
-        // Send the audio packet to the server
-        return m_socket.send(packet) == sf::Socket::Status::Done;
+        for (;;)
+        {
+            // Check the flag before reading, so that the last samples are sent after the capture stops
+            const bool sending = m_sending;
+
+            const std::size_t sampleCount = read(samples.data(), samples.size());
+            if (sampleCount == 0)
+            {
+                if (!sending)
+                    break;
+
+                sf::sleep(sf::milliseconds(2));
+                continue;
+            }
+
+            // Pack the audio samples into a network packet
+            sf::Packet packet;
+            packet << clientAudioData;
+            packet.append(samples.data(), sampleCount * sizeof(std::int16_t));
+
+            // Send the audio packet to the server
+            if (m_socket.send(packet) != sf::Socket::Status::Done)
+                break;
+        }
     }
 
     ////////////////////////////////////////////////////////////
@@ -81,6 +109,13 @@ private:
     ////////////////////////////////////////////////////////////
     void onStop() override
     {
+        // Wait until the remaining audio data is sent
+        m_sending = false;
+        m_sender.join();
+
+        if (getDroppedSampleCount() > 0)
+            std::cout << getDroppedSampleCount() << " samples could not be sent in time" << std::endl;
+
         // Send a "end-of-stream" packet
         sf::Packet packet;
         packet << clientEndOfStream;
@@ -97,9 +132,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    sf::IpAddress  m_host;   ///< Address of the remote host
-    unsigned short m_port;   ///< Remote port
-    sf::TcpSocket  m_socket; ///< Socket used to communicate with the server
+    sf::IpAddress     m_host;           ///< Address of the remote host
+    unsigned short    m_port;           ///< Remote port
+    sf::TcpSocket     m_socket;         ///< Socket used to communicate with the server
+    std::thread       m_sender;         ///< Thread sending the captured audio data
+    std::atomic<bool> m_sending{false}; ///< Is the capture still running?
 };
 
 
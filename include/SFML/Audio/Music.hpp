@@ -196,8 +196,9 @@ public:
     /// safely called at any point after a stream is opened, and will be applied to a playing sound
     /// without affecting the current playing offset.
     ///
-    /// \warning Setting the loop points while the stream's status is Paused
-    /// will set its status to Stopped. The playing offset will be unaffected.
+    /// \warning Setting the loop points while the stream's status is Paused,
+    /// with a loop end before the part of the music already buffered, will
+    /// set its status to Stopped. The playing offset will be unaffected.
     ///
     /// \param timePoints The definition of the loop. Can be any time points within the sound's length
     ///
@@ -247,6 +248,34 @@ private:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the first samples of the loop in advance
+    ///
+    /// When the stream loops, these samples are queued from
+    /// memory, so that the loop seam doesn't have to wait for
+    /// the decoder to seek. The seek past them is done by the
+    /// next onGetData() call, which still runs on the streaming
+    /// thread, but while the loop head is already queued for
+    /// playback.
+    ///
+    /// The loop head is normally filled while the file is read
+    /// through the beginning of the loop. This function is only
+    /// called from onGetData(), when looping is enabled and the
+    /// beginning of the loop has already been read past.
+    ///
+    ////////////////////////////////////////////////////////////
+    void decodeLoopHead();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the file to the position matching what has been played
+    ///
+    /// While the loop head is played from memory, the file is
+    /// not at the logical read position. This function performs
+    /// the pending seek, if any.
+    ///
+    ////////////////////////////////////////////////////////////
+    void syncLoopHead();
+
     ////////////////////////////////////////////////////////////
     /// \brief Helper to convert an sf::Time to a sample position
     ///
@@ -270,10 +299,13 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    InputSoundFile            m_file;     //!< The streamed music file
-    std::vector<std::int16_t> m_samples;  //!< Temporary buffer of samples
-    std::recursive_mutex      m_mutex;    //!< Mutex protecting the data
-    Span<std::uint64_t>       m_loopSpan; //!< Loop Range Specifier
+    InputSoundFile            m_file;         //!< The streamed music file
+    std::vector<std::int16_t> m_samples;      //!< Temporary buffer of samples
+    std::recursive_mutex      m_mutex;        //!< Mutex protecting the data
+    Span<std::uint64_t>       m_loopSpan;     //!< Loop Range Specifier
+    std::vector<std::int16_t> m_loopHead;     //!< First samples of the loop, decoded in advance
+    bool                      m_playLoopHead; //!< Must the next chunk be served from the loop head?
+    bool                      m_skipLoopHead; //!< Must the file seek past the loop head before reading?
 };
 
 } // namespace sf
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundRecorder.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Specialized SoundRecorder which queues the captured
+///        audio data for another thread
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API QueuedSoundRecorder : public SoundRecorder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// The queue is allocated when the capture starts, once
+    /// the sample rate and the channel count are known.
+    ///
+    /// \param capacity Duration of audio that the queue can hold
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit QueuedSoundRecorder(Time capacity = seconds(1));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~QueuedSoundRecorder() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take captured samples out of the queue
+    ///
+    /// This function never blocks: it returns 0 if no sample
+    /// was captured since the last call. Only whole frames are
+    /// read (\a maxCount is rounded down to a multiple of the
+    /// channel count).
+    ///
+    /// It must always be called from the same thread, but that
+    /// thread can be different from the capture thread, and
+    /// the function can be called while the capture runs. It
+    /// must not be called while start() runs, since the queue
+    /// is allocated there.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t read(std::int16_t* samples, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples dropped because the queue was full
+    ///
+    /// Samples are dropped when read() is not called often
+    /// enough. The count is reset when the capture starts.
+    ///
+    /// \return Number of samples dropped since the capture started
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getDroppedSampleCount() const;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start capturing audio data
+    ///
+    /// Allocates and clears the queue. Derived classes which
+    /// override this function must call it.
+    ///
+    /// \return True to start the capture, or false to abort it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onStart() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a new chunk of recorded samples
+    ///
+    /// Copies the samples into the queue, without allocating
+    /// nor locking.
+    ///
+    /// \param samples     Pointer to the new chunk of recorded samples
+    /// \param sampleCount Number of samples pointed by \a samples
+    ///
+    /// \return True to continue the capture, or false to stop it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onProcessSamples(const std::int16_t* samples, std::size_t sampleCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Time                       m_capacity;   //!< Duration of audio that the queue can hold
+    std::vector<std::int16_t>  m_queue;      //!< Ring buffer of captured samples
+    std::atomic<std::uint64_t> m_writeCount; //!< Number of samples written to the queue (by the capture thread)
+    std::atomic<std::uint64_t> m_readCount;  //!< Number of samples read from the queue (by the consumer thread)
+    std::atomic<std::uint64_t> m_dropCount;  //!< Number of samples dropped because the queue was full
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::QueuedSoundRecorder
+/// \ingroup audio
+///
+/// sf::QueuedSoundRecorder hands the captured audio data over
+/// to another thread. The capture thread copies each chunk of
+/// samples into a ring buffer allocated when the capture
+/// starts, and a consumer thread takes them out with read().
+/// The handoff is lock-free, so a slow consumer (sending the
+/// samples over the network, encoding them, etc.) never delays
+/// the capture: when the queue is full, the new samples are
+/// dropped and counted (see getDroppedSampleCount()).
+///
+/// Combined with a short processing interval, this is suited
+/// to low-latency capture, for example for voice chat.
+///
+/// There must be a single consumer thread. As usual, don't
+/// forget to call the isAvailable() function before using this
+/// class (see sf::SoundRecorder for more details about this).
+///
+/// Usage example:
+/// \code
+/// if (sf::QueuedSoundRecorder::isAvailable())
+/// {
+///     sf::QueuedSoundRecorder recorder;
+///     if (!recorder.start())
+///     {
+///         // Handle error...
+///     }
+///
+///     // On the consumer thread
+///     std::int16_t samples[4096];
+///     while (...)
+///     {
+///         const std::size_t count = recorder.read(samples, 4096);
+///         if (count > 0)
+///             send(samples, count);
+///         else
+///             sf::sleep(sf::milliseconds(2));
+///     }
+///
+///     recorder.stop();
+/// }
+/// \endcode
+///
+/// \see sf::SoundRecorder
+///
+////////////////////////////////////////////////////////////
@@ -159,9 +159,12 @@ public:
     /// The total number of samples in this array is given by the
     /// getSampleCount() function.
     ///
+    /// If the samples have been released with releaseSamples(),
+    /// this function returns a null pointer.
+    ///
     /// \return Read-only pointer to the array of sound samples
     ///
-    /// \see getSampleCount
+    /// \see getSampleCount, releaseSamples
     ///
     ////////////////////////////////////////////////////////////
     const std::int16_t* getSamples() const;
@@ -172,6 +175,9 @@ public:
     /// The array of samples can be accessed with the getSamples()
     /// function.
     ///
+    /// The returned count is still valid after the samples
+    /// have been released with releaseSamples().
+    ///
     /// \return Number of samples
     ///
     /// \see getSamples
@@ -179,6 +185,22 @@ public:
     ////////////////////////////////////////////////////////////
     std::uint64_t getSampleCount() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the copy of the audio samples kept in system memory
+    ///
+    /// Once loaded, the samples are uploaded to the audio device,
+    /// and the copy kept by the sound buffer is only needed to
+    /// access them with getSamples(), to save them with saveToFile()
+    /// or to copy the sound buffer. If you don't need any of these,
+    /// calling this function frees that memory while the sound
+    /// remains playable. Copying a sound buffer whose samples
+    /// have been released produces an empty sound buffer.
+    ///
+    /// \see getSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseSamples();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the sample rate of the sound
     ///
@@ -228,6 +250,7 @@ public:
 
 private:
     friend class Sound;
+    friend class SoundBufferCache;
 
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new sound
@@ -274,10 +297,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int              m_buffer;   //!< OpenAL buffer identifier
-    std::vector<std::int16_t> m_samples;  //!< Samples buffer
-    Time                      m_duration; //!< Sound duration
-    mutable SoundList         m_sounds;   //!< List of sounds that are using this buffer
+    unsigned int              m_buffer;      //!< OpenAL buffer identifier
+    std::vector<std::int16_t> m_samples;     //!< Samples buffer
+    std::uint64_t             m_sampleCount; //!< Number of samples uploaded to the OpenAL buffer
+    Time                      m_duration;    //!< Sound duration
+    mutable SoundList         m_sounds;      //!< List of sounds that are using this buffer
 };
 
 } // namespace sf
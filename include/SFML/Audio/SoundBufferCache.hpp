@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Cache of sounds kept compressed in memory and
+///        decoded on demand
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundBufferCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the cache with a budget for decoded sounds
+    ///
+    /// \param maxDecodedSize Maximum size of the decoded sounds kept alive, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoundBufferCache(std::size_t maxDecodedSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache(const SoundBufferCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache& operator=(const SoundBufferCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache(SoundBufferCache&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache& operator=(SoundBufferCache&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sound to the cache from a file
+    ///
+    /// The file is read into memory in its compressed form;
+    /// it is only decoded the first time the sound is requested
+    /// with get(). See the documentation of sf::InputSoundFile
+    /// for the list of supported formats.
+    ///
+    /// \param name     Name identifying the sound in the cache
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see loadFromMemory, get
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromFile(const std::string& name, const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sound to the cache from a file in memory
+    ///
+    /// The data is copied, so the caller can release it once
+    /// this function returns.
+    ///
+    /// \param name        Name identifying the sound in the cache
+    /// \param data        Pointer to the file data in memory
+    /// \param sizeInBytes Size of the data to load, in bytes
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see loadFromFile, get
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromMemory(const std::string& name, const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a decoded sound buffer
+    ///
+    /// If the sound is not decoded yet, it is decoded and
+    /// uploaded to the audio device, and the least recently
+    /// used decoded sounds are evicted until the decoded size
+    /// fits in the budget again. Sound buffers still used by
+    /// a sf::Sound are never evicted.
+    ///
+    /// The returned sound buffer doesn't keep a copy of its
+    /// samples in system memory (see SoundBuffer::releaseSamples).
+    ///
+    /// \param name Name of the sound
+    ///
+    /// \return Pointer to the sound buffer, or a null pointer if the sound is unknown or failed to decode
+    ///
+    ////////////////////////////////////////////////////////////
+    const SoundBuffer* get(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a sound from the cache
+    ///
+    /// \param name Name of the sound to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the budget for decoded sounds
+    ///
+    /// \param maxDecodedSize Maximum size of the decoded sounds kept alive, in bytes
+    ///
+    /// \see getMaxDecodedSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxDecodedSize(std::size_t maxDecodedSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the budget for decoded sounds
+    ///
+    /// \return Maximum size of the decoded sounds kept alive, in bytes
+    ///
+    /// \see setMaxDecodedSize
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getMaxDecodedSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the sounds currently decoded
+    ///
+    /// This may exceed the budget if sounds in use prevent
+    /// the cache from evicting enough data.
+    ///
+    /// \return Size of the decoded sounds, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDecodedSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the compressed sounds stored in the cache
+    ///
+    /// \return Size of the compressed sounds, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCompressedSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict least recently used decoded sounds until the budget is respected
+    ///
+    ////////////////////////////////////////////////////////////
+    void evict();
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::vector<std::byte>       data;     //!< Compressed file contents
+        std::unique_ptr<SoundBuffer> buffer;   //!< Decoded sound, if any
+        std::size_t                  size;     //!< Size of the decoded sound, in bytes
+        std::uint64_t                lastUsed; //!< Value of the use counter when the sound was last requested
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unordered_map<std::string, Entry> m_entries;        //!< Sounds stored in the cache, by name
+    std::size_t                            m_maxDecodedSize; //!< Maximum size of the decoded sounds, in bytes
+    std::size_t                            m_decodedSize;    //!< Current size of the decoded sounds, in bytes
+    std::size_t                            m_compressedSize; //!< Current size of the compressed sounds, in bytes
+    std::uint64_t                          m_useCounter;     //!< Counter incremented on each request, for LRU ordering
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundBufferCache
+/// \ingroup audio
+///
+/// sf::SoundBufferCache is meant for large libraries of short
+/// sounds that don't all need to be ready to play at the same
+/// time. Sounds are stored in their compressed form (Ogg, FLAC,
+/// MP3, ...), which is usually an order of magnitude smaller
+/// than the decoded samples, and they are decoded the first
+/// time they are requested.
+///
+/// To keep the memory usage bounded, the cache evicts the least
+/// recently requested decoded sounds once the total size of the
+/// decoded sounds exceeds the given budget. The compressed data
+/// is kept, so an evicted sound is simply decoded again the next
+/// time it is requested. A sound buffer is never evicted while
+/// a sf::Sound uses it.
+///
+/// The pointer returned by get() stays valid until the sound is
+/// evicted or removed, so it should be requested again rather
+/// than stored when it's not attached to a sf::Sound.
+///
+/// Usage example:
+/// \code
+/// // Keep at most 64 MB of decoded sounds
+/// sf::SoundBufferCache cache(64 * 1024 * 1024);
+///
+/// if (!cache.loadFromFile("explosion", "explosion.ogg"))
+/// {
+///     // error...
+/// }
+///
+/// // Decoded on first request
+/// if (const sf::SoundBuffer* buffer = cache.get("explosion"))
+/// {
+///     sound.setBuffer(*buffer);
+///     sound.play();
+/// }
+/// \endcode
+///
+/// \see sf::SoundBuffer, sf::Sound
+///
+////////////////////////////////////////////////////////////
@@ -202,6 +202,10 @@ protected:
     /// want to use a small interval if you want to process the
     /// recorded data in real time, for example.
     ///
+    /// The capture thread wakes up when a full interval of
+    /// samples is expected to be available, so intervals of a
+    /// few milliseconds can be used for low-latency capture.
+    ///
     /// Note: this is only a hint, the actual period may vary.
     /// So don't rely on this parameter to implement precise timing.
     ///
@@ -272,6 +276,14 @@ private:
     ////////////////////////////////////////////////////////////
     void processCapturedSamples();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time until a full processing interval of samples is captured
+    ///
+    /// \return Time to wait before processing the captured samples
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getCaptureDelay() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up the recorder's internal resources
     ///
@@ -323,7 +335,9 @@ private:
 /// about capturing sound samples, the task of making something
 /// useful with them is left to the derived class. Note that
 /// SFML provides a built-in specialization for saving the
-/// captured data to a sound buffer (see sf::SoundBufferRecorder).
+/// captured data to a sound buffer (see sf::SoundBufferRecorder),
+/// and one for handing it over to another thread without
+/// locking (see sf::QueuedSoundRecorder).
 ///
 /// A derived class has only one virtual function to override:
 /// \li onProcessSamples provides the new chunks of audio samples while the capture happens
@@ -34,11 +34,15 @@
 
 #include <cstdlib>
 #include <mutex>
-#include <thread>
 
 
 namespace sf
 {
+namespace priv
+{
+class StreamScheduler;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Abstract base class for streamed audio sources
 ///
@@ -68,8 +72,9 @@ public:
     /// This function starts the stream if it was stopped, resumes
     /// it if it was paused, and restarts it from the beginning if
     /// it was already playing.
-    /// This function uses its own thread so that it doesn't block
-    /// the rest of the program while the stream is played.
+    /// The stream is updated from a background thread shared by
+    /// all the streams, so that it doesn't block the rest of the
+    /// program while the stream is played.
     ///
     /// \see pause, stop
     ///
@@ -213,7 +218,7 @@ protected:
     ///
     /// This function must be overridden by derived classes to provide
     /// the audio samples to play. It is called continuously by the
-    /// streaming loop, in a separate thread.
+    /// streaming loop, in the background streaming thread.
     /// The source can choose to stop the streaming loop at any time, by
     /// returning false to the caller.
     /// If you return true (i.e. continue streaming) it is important that
@@ -265,14 +270,38 @@ protected:
     void setProcessingInterval(Time interval);
 
 private:
+    friend class priv::StreamScheduler;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the buffers, fill them and start the playback
+    ///
+    /// This function is called by the streaming scheduler the
+    /// first time it services the stream.
+    ///
+    /// \return True if the stream must keep being updated, false if it was launched stopped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool startStreaming();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run one iteration of the streaming loop
+    ///
+    /// This function refills the buffers that have been
+    /// processed. When streaming ends, it stops the playback
+    /// and deletes the buffers.
+    ///
+    /// \return True if the stream must keep being updated, false if streaming has ended
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool updateStreaming();
+
     ////////////////////////////////////////////////////////////
-    /// \brief Function called as the entry point of the thread
+    /// \brief Stop the playback and release the buffers
     ///
-    /// This function starts the streaming loop, and returns
-    /// only when the sound is stopped.
+    /// This function is called when the streaming loop ends.
     ///
     ////////////////////////////////////////////////////////////
-    void streamData();
+    void finishStreaming();
 
     ////////////////////////////////////////////////////////////
     /// \brief Fill a new buffer with audio samples, and append
@@ -310,7 +339,7 @@ private:
     void clearQueue();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Launch a new stream thread running 'streamData'
+    /// \brief Hand the stream over to the streaming scheduler
     ///
     /// This function is called when the stream is played or
     /// when the playing offset is changed.
@@ -319,7 +348,7 @@ private:
     void launchStreamingThread(Status threadStartState);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Stop streaming and wait for 'm_thread' to join
+    /// \brief Stop streaming and wait for the scheduler to release the stream
     ///
     /// This function is called when the playback is stopped or
     /// when the sound stream is destroyed.
@@ -336,10 +365,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::thread                  m_thread;               //!< Thread running the background tasks
-    mutable std::recursive_mutex m_threadMutex;          //!< Thread mutex
-    Status                       m_threadStartState;     //!< State the thread starts in (Playing, Paused, Stopped)
+    bool                         m_isScheduled;          //!< Has the stream been handed to the scheduler and not awaited yet?
+    mutable std::recursive_mutex m_threadMutex;          //!< Mutex protecting the state shared with the streaming thread
+    Status                       m_threadStartState;     //!< State the stream starts in (Playing, Paused, Stopped)
     bool                         m_isStreaming;          //!< Streaming state (true = playing, false = stopped)
+    bool                         m_requestStop;          //!< Has the stream source requested to stop?
     unsigned int                 m_buffers[BufferCount]; //!< Sound buffers used to store temporary audio data
     unsigned int                 m_channelCount;         //!< Number of channels (1 = mono, 2 = stereo, ...)
     unsigned int                 m_sampleRate;           //!< Frequency (samples / second)
@@ -378,10 +408,12 @@ private:
 /// \li onGetData fills a new chunk of audio data to be played
 /// \li onSeek changes the current playing position in the source
 ///
-/// It is important to note that each SoundStream is played in its
-/// own separate thread, so that the streaming loop doesn't block the
-/// rest of the program. In particular, the OnGetData and OnSeek
-/// virtual functions may sometimes be called from this separate thread.
+/// It is important to note that SoundStreams are updated from a
+/// background thread shared by all streams, so that the streaming
+/// loop doesn't block the rest of the program. In particular, the
+/// OnGetData and OnSeek virtual functions may sometimes be called
+/// from this separate thread. Since the thread is shared, onGetData
+/// should return quickly to avoid starving the other streams.
 /// It is important to keep this in mind, because you may have to take
 /// care of synchronization issues if you share data between threads.
 ///
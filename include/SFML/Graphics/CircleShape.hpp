@@ -31,6 +31,9 @@
 
 #include <SFML/Graphics/Shape.hpp>
 
+#include <memory>
+#include <vector>
+
 
 namespace sf
 {
@@ -105,12 +108,21 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2f getPoint(std::size_t index) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the circle
+    ///
+    /// \param points Array receiving the points, must have room for getPointCount() elements
+    ///
+    ////////////////////////////////////////////////////////////
+    void getPoints(Vector2f* points) const override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float       m_radius;     //!< Radius of the circle
-    std::size_t m_pointCount; //!< Number of points composing the circle
+    float                                        m_radius;     //!< Radius of the circle
+    std::size_t                                  m_pointCount; //!< Number of points composing the circle
+    std::shared_ptr<const std::vector<Vector2f>> m_unitCircle; //!< Points of the unit circle, shared by all circles
 };
 
 } // namespace sf
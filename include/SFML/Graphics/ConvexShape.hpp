@@ -111,6 +111,14 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2f getPoint(std::size_t index) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the polygon
+    ///
+    /// \param points Array receiving the points, must have room for getPointCount() elements
+    ///
+    ////////////////////////////////////////////////////////////
+    void getPoints(Vector2f* points) const override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
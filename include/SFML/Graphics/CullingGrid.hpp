@@ -0,0 +1,276 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+namespace sf
+{
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Spatial index of drawables, used to draw only
+///        those that are visible in the current view
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CullingGrid : public Drawable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The grid is unbounded, only the cells that contain
+    /// drawables use memory. A good cell size is roughly the
+    /// size of the largest common drawable, or a fraction of
+    /// the view size.
+    ///
+    /// \param cellSize Size of the square cells of the grid, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit CullingGrid(float cellSize = 256.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a drawable to the grid
+    ///
+    /// The grid only stores a pointer to the drawable: it must
+    /// stay alive, and at the same address, until it is removed
+    /// from the grid or the grid is destroyed.
+    ///
+    /// \param drawable Drawable to add
+    /// \param bounds   Bounds of the drawable in world coordinates, usually its global bounds
+    ///
+    /// \return Handle of the drawable, to be passed to update and remove
+    ///
+    /// \see update, remove
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t insert(const Drawable& drawable, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounds of a drawable
+    ///
+    /// This function must be called whenever the drawable moves
+    /// or changes its size. It is cheap when the drawable stays
+    /// within the same cells.
+    ///
+    /// \param handle Handle of the drawable, as returned by insert
+    /// \param bounds New bounds of the drawable in world coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(std::size_t handle, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a drawable from the grid
+    ///
+    /// The handle may be returned again by a later call to insert.
+    ///
+    /// \param handle Handle of the drawable, as returned by insert
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the drawables from the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of drawables in the grid
+    ///
+    /// \return Number of drawables
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDrawableCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the drawables whose bounds intersect an area
+    ///
+    /// The drawables are returned in increasing handle order,
+    /// so that the drawing order doesn't depend on the cells
+    /// they fall in.
+    ///
+    /// \param area      Area to look in, in world coordinates
+    /// \param drawables Receives the drawables found (it is cleared first)
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const FloatRect& area, std::vector<const Drawable*>& drawables) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the drawables that are visible in a view
+    ///
+    /// \param view      View to test against
+    /// \param drawables Receives the drawables found (it is cleared first)
+    ///
+    /// \see computeVisibleArea
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const View& view, std::vector<const Drawable*>& drawables) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the area of the world that a view shows
+    ///
+    /// The corners of the view are mapped back to world
+    /// coordinates with the inverse view transform, so the
+    /// result also covers rotated views.
+    ///
+    /// \param view View to compute the visible area of
+    ///
+    /// \return Bounding rectangle of the visible area, in world coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    static FloatRect computeVisibleArea(const View& view);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible drawables to a render target
+    ///
+    /// The visible area is computed from the current view of
+    /// the target, and brought back to the local coordinates
+    /// of the grid with the inverse of the states transform.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const RenderStates& states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Inclusive range of cells covered by a rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CellRange
+    {
+        int left;   //!< Column of the leftmost cells
+        int top;    //!< Row of the topmost cells
+        int right;  //!< Column of the rightmost cells
+        int bottom; //!< Row of the bottommost cells
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure holding a drawable of the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Item
+    {
+        const Drawable* drawable; //!< Drawable, or null if the handle is free
+        FloatRect       bounds;   //!< Bounds of the drawable in world coordinates
+        CellRange       cells;    //!< Cells the drawable is registered in
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using CellMap = std::unordered_map<std::uint64_t, std::vector<std::size_t>>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the cells covered by a rectangle
+    ///
+    /// \param rectangle Rectangle in world coordinates
+    ///
+    /// \return Range of cells covered by the rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    CellRange computeCellRange(const FloatRect& rectangle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register or unregister a drawable in a range of cells
+    ///
+    /// \param handle Handle of the drawable
+    /// \param range  Cells to update
+    /// \param add    True to add the drawable to the cells, false to remove it
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(std::size_t handle, const CellRange& range, bool add);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the handles of the drawables intersecting an area
+    ///
+    /// \param area    Area to look in, in world coordinates
+    /// \param handles Receives the sorted handles (it is cleared first)
+    ///
+    ////////////////////////////////////////////////////////////
+    void collect(const FloatRect& area, std::vector<std::size_t>& handles) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    float                    m_cellSize;    //!< Size of the cells
+    std::vector<Item>        m_items;       //!< Drawables, indexed by handle
+    std::vector<std::size_t> m_freeHandles; //!< Handles of removed drawables
+    CellMap                  m_cells;       //!< Handles of the drawables of each non-empty cell, by cell key
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CullingGrid
+/// \ingroup graphics
+///
+/// Render targets process every drawable they are given,
+/// even if it ends up entirely outside the view. In large
+/// worlds, where most objects are off-screen at any time,
+/// this wastes most of the drawing time.
+///
+/// sf::CullingGrid sorts drawables into the cells of a
+/// uniform grid according to their bounds. When the grid
+/// is drawn, only the cells overlapping the visible area of
+/// the target's view are visited, and only the drawables
+/// whose bounds intersect that area are drawn. Drawables
+/// are drawn in the order they were inserted (more exactly,
+/// in increasing handle order).
+///
+/// The grid doesn't track the drawables by itself: when one
+/// of them moves, update must be called with its new bounds.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::Sprite> trees = ...;
+///
+/// sf::CullingGrid grid(512.f);
+/// for (const sf::Sprite& tree : trees)
+///     grid.insert(tree, tree.getGlobalBounds());
+///
+/// // Only the trees visible in the window's view are drawn
+/// window.draw(grid);
+/// \endcode
+///
+/// \see sf::View, sf::Drawable
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Large set of short-lived textured quads,
+///        updated and drawn in bulk
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ParticleSystem : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty particle system
+    ///
+    /// All the memory needed by the particles is allocated
+    /// here, emitting and updating particles never allocates.
+    ///
+    /// \param capacity Maximum number of living particles
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ParticleSystem(std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Emit a new particle
+    ///
+    /// \param position Initial position of the particle, in local coordinates
+    /// \param velocity Initial velocity of the particle, in units per second
+    /// \param lifetime Time the particle lives
+    /// \param color    Color of the particle at its birth
+    /// \param size     Size of the side of the square quad of the particle
+    ///
+    /// \return True if the particle was emitted, false if the system is full
+    ///
+    ////////////////////////////////////////////////////////////
+    bool emit(const Vector2f& position,
+              const Vector2f& velocity,
+              Time            lifetime,
+              const Color&    color = Color::White,
+              float           size  = 1.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advance the simulation of the particles
+    ///
+    /// The velocity of every particle is increased by the
+    /// acceleration, then its position by its velocity, its
+    /// color is faded and dead particles are removed. The
+    /// vertices of the particles are written in the same pass.
+    ///
+    /// With \a threadCount greater than 1, large systems are
+    /// split in that many blocks, updated in parallel.
+    ///
+    /// \param elapsed     Time elapsed since the last update
+    /// \param threadCount Maximum number of threads to use
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed, unsigned int threadCount = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of living particles
+    ///
+    /// \return Number of living particles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getParticleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of living particles
+    ///
+    /// \return Capacity of the system
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the vertices of the living particles
+    ///
+    /// Each particle has 4 vertices, written when it is emitted
+    /// and at every update. The array contains the vertices of
+    /// the getParticleCount() living particles, in the order
+    /// they were emitted.
+    ///
+    /// \return Pointer to the vertices of the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vertex* getVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the acceleration applied to all the particles
+    ///
+    /// The acceleration is zero by default.
+    ///
+    /// \param acceleration Acceleration, in units per second squared
+    ///
+    /// \see getAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAcceleration(const Vector2f& acceleration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the acceleration applied to all the particles
+    ///
+    /// \return Acceleration, in units per second squared
+    ///
+    /// \see setAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getAcceleration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color particles are modulated with at their death
+    ///
+    /// The color of a particle goes linearly from its birth
+    /// color to its birth color modulated by \a color. The
+    /// default is sf::Color(255, 255, 255, 0), which makes
+    /// particles fade out.
+    ///
+    /// \param color Modulation color at the end of the life of particles
+    ///
+    /// \see getFadeColor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFadeColor(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color particles are modulated with at their death
+    ///
+    /// \return Modulation color at the end of the life of particles
+    ///
+    /// \see setFadeColor
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getFadeColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture of the particles
+    ///
+    /// The \a texture argument refers to a texture that must
+    /// exist as long as the particle system uses it. If
+    /// \a resetRect is true, or if no texture and texture
+    /// rectangle were set before, the texture rectangle is
+    /// set to the whole texture.
+    ///
+    /// \param texture   New texture, or null to draw plain colored quads
+    /// \param resetRect Should the texture rect be reset to the size of the new texture?
+    ///
+    /// \see getTexture, setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture, bool resetRect = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of the particles
+    ///
+    /// \return Pointer to the texture, or null if there is none
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the part of the texture that all the particles display
+    ///
+    /// The change is applied to the vertices at the next update.
+    ///
+    /// \param rect Rectangle defining the region of the texture to display
+    ///
+    /// \see getTextureRect, setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the part of the texture that all the particles display
+    ///
+    /// \return Texture rectangle of the particles
+    ///
+    /// \see setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    const IntRect& getTextureRect() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particles to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const RenderStates& states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a block of particles
+    ///
+    /// The surviving particles of the block are moved to its
+    /// beginning, and their vertices written at the same index.
+    ///
+    /// \param first   Index of the first particle of the block
+    /// \param count   Number of particles of the block
+    /// \param seconds Time elapsed since the last update, in seconds
+    ///
+    /// \return Number of surviving particles of the block
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t updateBlock(std::size_t first, std::size_t count, float seconds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the vertices of a particle
+    ///
+    /// \param index Index of the particle
+    /// \param color Current color of the particle
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateQuad(std::size_t index, const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move particles and their vertices to another index
+    ///
+    /// \param from  Index of the first particle to move
+    /// \param to    Destination index
+    /// \param count Number of consecutive particles to move
+    ///
+    ////////////////////////////////////////////////////////////
+    void moveParticles(std::size_t from, std::size_t to, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f>              m_positions;                   //!< Position of each particle
+    std::vector<Vector2f>              m_velocities;                  //!< Velocity of each particle
+    std::vector<float>                 m_remainingLives;              //!< Seconds left to live of each particle
+    std::vector<float>                 m_lifetimes;                   //!< Total lifetime of each particle, in seconds
+    std::vector<Color>                 m_colors;                      //!< Birth color of each particle
+    std::vector<float>                 m_sizes;                       //!< Size of each particle
+    std::vector<Vertex>                m_vertices;                    //!< 4 vertices per particle
+    std::size_t                        m_count{0};                    //!< Number of living particles
+    Vector2f                           m_acceleration;                //!< Acceleration of all the particles
+    Color                              m_fadeColor{255, 255, 255, 0}; //!< Modulation at the death of particles
+    const Texture*                     m_texture{nullptr};            //!< Texture of the particles
+    IntRect                            m_textureRect;                 //!< Texture rectangle of the particles
+    mutable VertexBuffer               m_vertexBuffer;                //!< Vertices of the particles on the GPU
+    mutable IndexBuffer                m_indexBuffer;                 //!< Indices of the quads of all the particles
+    mutable std::vector<std::uint32_t> m_indices;                     //!< Indices of the quads of all the particles
+    mutable bool                       m_needUpload{false};           //!< Do the vertices need to be uploaded?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// Drawing thousands of sf::Sprite instances, one draw call
+/// each, quickly becomes the bottleneck of particle effects.
+/// sf::ParticleSystem keeps the state of its particles in
+/// separate contiguous arrays (positions, velocities, lives,
+/// colors, sizes), updates them in bulk with SIMD-friendly
+/// loops, and draws all of them in a single draw call from
+/// a streaming vertex buffer.
+///
+/// When drawn to a render queue (for example a
+/// sf::RenderCommandBuffer filled on a worker thread), the
+/// vertices are recorded instead of being uploaded to the
+/// vertex buffer, so that no OpenGL call is made.
+///
+/// The memory of all the particles is allocated once, when
+/// the system is created. Dead particles are removed during
+/// the update by moving the surviving ones down, in the same
+/// pass that writes their vertices, so the order in which
+/// particles are drawn is stable.
+///
+/// All the particles share the same texture rectangle, and
+/// are drawn as axis-aligned squares centered on their
+/// position.
+///
+/// Usage example:
+/// \code
+/// sf::ParticleSystem sparks(100000);
+/// sparks.setTexture(&sparkTexture);
+/// sparks.setAcceleration({0.f, 200.f});
+///
+/// while (window.isOpen())
+/// {
+///     for (int i = 0; i < 100; ++i)
+///         sparks.emit(emitterPosition, randomVelocity(), sf::seconds(2.f), sf::Color::Yellow, 4.f);
+///
+///     sparks.update(clock.restart(), std::thread::hardware_concurrency());
+///
+///     window.clear();
+///     window.draw(sparks);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::Sprite
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,520 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Polygon shape that can be concave and have holes
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API PolygonShape : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Shapes of the outline at the corners of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class JoinStyle
+    {
+        Miter, //!< Extend the outline edges until they meet (up to the miter limit, then bevel)
+        Bevel, //!< Cut the corner with a straight segment
+        Round  //!< Round the corner with an arc
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// \param pointCount Number of points of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PolygonShape(std::size_t pointCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of points of the polygon
+    ///
+    /// For the shape to be rendered as expected, \a count must
+    /// be greater or equal to 3.
+    ///
+    /// \param count New number of points of the polygon
+    ///
+    /// \see getPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPointCount(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of points of the polygon
+    ///
+    /// \return Number of points of the polygon
+    ///
+    /// \see setPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPointCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a point of the outer contour
+    ///
+    /// The points can be given in clockwise or counter-clockwise
+    /// order, the polygon can be concave but its edges should
+    /// not cross each other.
+    ///
+    /// Point count must be specified beforehand. The behavior is
+    /// undefined if \a index is greater than or equal to getPointCount.
+    ///
+    /// \param index Index of the point to change, in range [0 .. getPointCount() - 1]
+    /// \param point New position of the point
+    ///
+    /// \see getPoint
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPoint(std::size_t index, const Vector2f& point);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a point of the outer contour
+    ///
+    /// The returned point is in local coordinates, that is,
+    /// the shape's transforms (position, rotation, scale) are
+    /// not taken into account.
+    /// The result is undefined if \a index is out of the valid range.
+    ///
+    /// \param index Index of the point to get, in range [0 .. getPointCount() - 1]
+    ///
+    /// \return Position of the index-th point of the polygon
+    ///
+    /// \see setPoint
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f getPoint(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a hole to the polygon
+    ///
+    /// A hole is a contour of at least 3 points, in any order,
+    /// that must lie inside the outer contour without crossing
+    /// it or the other holes.
+    ///
+    /// \param points Points of the hole
+    ///
+    /// \see getHole, clearHoles
+    ///
+    ////////////////////////////////////////////////////////////
+    void addHole(const std::vector<Vector2f>& points);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of holes of the polygon
+    ///
+    /// \return Number of holes
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getHoleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the points of a hole
+    ///
+    /// The result is undefined if \a index is out of the valid range.
+    ///
+    /// \param index Index of the hole, in range [0 .. getHoleCount() - 1]
+    ///
+    /// \return Points of the index-th hole
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<Vector2f>& getHole(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the holes of the polygon
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearHoles();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the shape
+    ///
+    /// The texture is mapped on the bounding rectangle of the
+    /// outer contour; it works exactly like sf::Shape::setTexture.
+    ///
+    /// \param texture   New texture
+    /// \param resetRect Should the texture rect be reset to the size of the new texture?
+    ///
+    /// \see getTexture, setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture, bool resetRect = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture that the shape will display
+    ///
+    /// \param rect Rectangle defining the region of the texture to display
+    ///
+    /// \see getTextureRect, setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fill color of the shape
+    ///
+    /// By default, the shape's fill color is opaque white.
+    ///
+    /// \param color New color of the shape
+    ///
+    /// \see getFillColor, setOutlineColor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFillColor(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the outline color of the shape
+    ///
+    /// By default, the shape's outline color is opaque white.
+    ///
+    /// \param color New outline color of the shape
+    ///
+    /// \see getOutlineColor, setFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineColor(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thickness of the shape's outline
+    ///
+    /// The outline is drawn around the outer contour and
+    /// inside the holes. Negative values make it expand
+    /// towards the inside of the polygon instead, and using
+    /// zero disables the outline.
+    /// By default, the outline thickness is 0.
+    ///
+    /// \param thickness New outline thickness
+    ///
+    /// \see getOutlineThickness
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineThickness(float thickness);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the shape of the outline at the corners
+    ///
+    /// By default, the join style is JoinStyle::Miter.
+    ///
+    /// \param style New join style
+    ///
+    /// \see getJoinStyle, setMiterLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    void setJoinStyle(JoinStyle style);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum length of the miter joins
+    ///
+    /// The limit is relative to the outline thickness: sharp
+    /// corners whose miter would be longer are beveled. It
+    /// also limits how far the inner side of a corner can go.
+    /// By default, the miter limit is 4.
+    ///
+    /// \param limit New miter limit, must be at least 1
+    ///
+    /// \see getMiterLimit, setJoinStyle
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMiterLimit(float limit);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the width of the anti-aliasing fringe
+    ///
+    /// When the width is not zero, the silhouette of the shape
+    /// (the outline if there is one, the inside otherwise) is
+    /// surrounded by a band that fades out to transparent, which
+    /// smooths its edges without multisampling. The width is in
+    /// local units: to get one pixel of smoothing, divide 1 by
+    /// the scale applied to the shape (view included).
+    /// The fringe is never textured.
+    /// By default, the smoothing width is 0.
+    ///
+    /// \param width New width of the fringe
+    ///
+    /// \see getSmoothing
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmoothing(float width);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the shape
+    ///
+    /// \return Pointer to the shape's texture
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by the shape
+    ///
+    /// \return Texture rectangle of the shape
+    ///
+    /// \see setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    const IntRect& getTextureRect() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill color of the shape
+    ///
+    /// \return Fill color of the shape
+    ///
+    /// \see setFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getFillColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outline color of the shape
+    ///
+    /// \return Outline color of the shape
+    ///
+    /// \see setOutlineColor
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getOutlineColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outline thickness of the shape
+    ///
+    /// \return Outline thickness of the shape
+    ///
+    /// \see setOutlineThickness
+    ///
+    ////////////////////////////////////////////////////////////
+    float getOutlineThickness() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shape of the outline at the corners
+    ///
+    /// \return Join style of the outline
+    ///
+    /// \see setJoinStyle
+    ///
+    ////////////////////////////////////////////////////////////
+    JoinStyle getJoinStyle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum length of the miter joins
+    ///
+    /// \return Miter limit, relative to the outline thickness
+    ///
+    /// \see setMiterLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    float getMiterLimit() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the width of the anti-aliasing fringe
+    ///
+    /// \return Width of the fringe
+    ///
+    /// \see setSmoothing
+    ///
+    ////////////////////////////////////////////////////////////
+    float getSmoothing() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    /// It includes the outline and the smoothing fringe.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global (non-minimal) bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the shape to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const RenderStates& states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the vertices and bounds are up to date
+    ///
+    /// Only the attributes that changed since the last call are
+    /// recomputed; in particular the polygon is triangulated
+    /// again only when its contours change.
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' position and triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateFill() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' color
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateFillColors() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' texture coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTexCoords() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the outline and fringe vertices and triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateOutline() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the outline and fringe vertices' color
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateOutlineColors() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f>              m_points;                        //!< Points of the outer contour
+    std::vector<std::vector<Vector2f>> m_holes;                         //!< Points of the holes
+    const Texture*                     m_texture{nullptr};              //!< Texture of the shape
+    IntRect                            m_textureRect;                   //!< Area of the source texture to display
+    Color                              m_fillColor{Color::White};       //!< Fill color
+    Color                              m_outlineColor{Color::White};    //!< Outline color
+    float                              m_outlineThickness{0};           //!< Thickness of the shape's outline
+    JoinStyle                          m_joinStyle{JoinStyle::Miter};   //!< Shape of the outline at the corners
+    float                              m_miterLimit{4};                 //!< Maximum miter length per unit of thickness
+    float                              m_smoothing{0};                  //!< Width of the anti-aliasing fringe
+    mutable std::vector<Vertex>        m_vertices;                      //!< Fill, outline, then fringe vertices
+    mutable std::vector<std::uint32_t> m_indices;                       //!< Fill, then outline and fringe triangles
+    mutable std::size_t                m_fillVertexCount{0};            //!< Number of vertices of the fill
+    mutable std::size_t                m_fillIndexCount{0};             //!< Number of indices of the fill
+    mutable std::size_t                m_fringeVertexStart{0};          //!< Index of the first fringe vertex
+    mutable FloatRect                  m_insideBounds;                  //!< Bounding rectangle of the outer contour
+    mutable FloatRect                  m_bounds;                        //!< Bounding rectangle of the whole geometry
+    mutable bool                       m_fillNeedUpdate{true};          //!< Do the contours need to be triangulated?
+    mutable bool                       m_fillColorsNeedUpdate{true};    //!< Do the fill colors need an update?
+    mutable bool                       m_texCoordsNeedUpdate{true};     //!< Do the texture coordinates need an update?
+    mutable bool                       m_outlineNeedUpdate{true};       //!< Does the outline geometry need an update?
+    mutable bool                       m_outlineColorsNeedUpdate{true}; //!< Do the outline colors need an update?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PolygonShape
+/// \ingroup graphics
+///
+/// sf::PolygonShape is a drawable class that displays an
+/// arbitrary simple polygon: unlike sf::ConvexShape, it can
+/// be concave and it can have holes. It has the same
+/// attributes as sf::Shape (texture, fill color, outline),
+/// plus a few that control how the outline is built:
+/// \li the join style and miter limit, used at the corners
+/// \li the smoothing width, which adds an anti-aliasing fringe
+///
+/// The polygon is triangulated by ear clipping (the holes are
+/// first bridged to the outer contour) the first time it is
+/// drawn after its points changed. The triangles are cached:
+/// changing the colors, the texture or the outline doesn't
+/// triangulate the polygon again.
+///
+/// Unlike the other shapes, the geometry is built on demand,
+/// so drawing a polygon or getting its bounds modifies its
+/// cache: the same polygon must not be drawn or queried from
+/// several threads at the same time (for example when it is
+/// recorded into several sf::RenderCommandBuffer instances).
+///
+/// Polygons whose edges cross each other can't be triangulated
+/// correctly; they are still drawn, but some parts may be
+/// missing or covered twice.
+///
+/// Usage example:
+/// \code
+/// sf::PolygonShape polygon(4);
+/// polygon.setPoint(0, sf::Vector2f(0, 0));
+/// polygon.setPoint(1, sf::Vector2f(100, 0));
+/// polygon.setPoint(2, sf::Vector2f(50, 40));
+/// polygon.setPoint(3, sf::Vector2f(50, 100));
+/// polygon.setOutlineColor(sf::Color::Red);
+/// polygon.setOutlineThickness(5);
+/// polygon.setJoinStyle(sf::PolygonShape::JoinStyle::Round);
+/// polygon.setSmoothing(1);
+/// polygon.setPosition({10, 20});
+/// ...
+/// window.draw(polygon);
+/// \endcode
+///
+/// \see sf::ConvexShape, sf::Shape, sf::Transformable
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/RenderQueue.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target recording draw commands instead of drawing them
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderCommandBuffer : public RenderTarget
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a command buffer
+    ///
+    /// The size defines the default view of the buffer, it should
+    /// match the size of the target the commands will be drawn to.
+    ///
+    /// \param size Size of the target the commands are recorded for, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit RenderCommandBuffer(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderCommandBuffer(const RenderCommandBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderCommandBuffer& operator=(const RenderCommandBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the target the commands are recorded for
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate or deactivate the command buffer for rendering
+    ///
+    /// A command buffer has no OpenGL context: activation always
+    /// fails, so that functions requiring OpenGL (clear, pushGLStates,
+    /// ...) do nothing instead of touching the context of the
+    /// calling thread.
+    ///
+    /// \param active True to activate, false to deactivate
+    ///
+    /// \return False if \a active is true, true otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setActive(bool active = true) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the queue holding the recorded commands
+    ///
+    /// \return Render queue of the command buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderQueue& getQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the queue holding the recorded commands
+    ///
+    /// \return Render queue of the command buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    const RenderQueue& getQueue() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard all recorded commands
+    ///
+    /// The memory of the buffer is kept, so that recording the
+    /// next frame doesn't allocate.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u    m_size;     //!< Size of the target the commands are recorded for
+    RenderQueue m_commands; //!< Recorded commands
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderCommandBuffer
+/// \ingroup graphics
+///
+/// sf::RenderCommandBuffer is a render target that doesn't
+/// touch OpenGL itself: everything drawn to it is recorded
+/// into its sf::RenderQueue. Vertices are generated, transformed
+/// and sorted on the CPU, so a command buffer can be filled on
+/// a thread without an active context, as long as the recorded
+/// drawables don't use OpenGL on their own.
+///
+/// Each thread records into its own command buffer. The
+/// render thread then appends the buffers to a single queue
+/// and flushes it, so that compatible commands of all the
+/// buffers are merged into as few draw calls as possible.
+///
+/// These drawables can be recorded on any thread:
+/// \li vertices passed directly to draw, and sf::VertexArray
+/// \li sf::Sprite and the sf::Shape classes
+/// \li sf::TileMap and sf::ParticleSystem, which record their
+///     vertices instead of using their vertex buffers when
+///     they are drawn to a render queue
+/// \li sf::VertexBuffer, which is only referenced: it must be
+///     created and updated on a thread with an active context
+///
+/// sf::Text must only be recorded on the render thread: it
+/// loads missing glyphs into the texture of its font, and
+/// sf::Font is not thread-safe. The same applies to custom
+/// drawables that call OpenGL or create graphics resources.
+///
+/// Drawing modifies the internal caches of some drawables
+/// (geometry of sf::PolygonShape, tile map chunks, ...): a
+/// drawable, or drawables sharing a font, must never be
+/// recorded from several threads at the same time.
+///
+/// Textures, shaders and vertex buffers are only referenced
+/// by the commands, they must stay alive and unchanged until
+/// the commands are flushed. Commands are drawn with the view
+/// of the target they are flushed to; the view of the command
+/// buffer is only there for drawing code that needs it, to
+/// cull invisible objects for example.
+///
+/// Usage example:
+/// \code
+/// std::vector<std::unique_ptr<sf::RenderCommandBuffer>> buffers;
+/// for (std::size_t i = 0; i < chunks.size(); ++i)
+///     buffers.push_back(std::make_unique<sf::RenderCommandBuffer>(window.getSize()));
+///
+/// // Worker threads
+/// std::for_each(std::execution::par, indices.begin(), indices.end(), [&](std::size_t i)
+/// {
+///     buffers[i]->reset();
+///     buffers[i]->setView(window.getView());
+///     chunks[i].draw(*buffers[i]);
+/// });
+///
+/// // Render thread
+/// sf::RenderQueue queue;
+/// for (const auto& buffer : buffers)
+///     queue.append(buffer->getQueue());
+///
+/// window.clear();
+/// queue.flush(window);
+/// window.display();
+/// \endcode
+///
+/// \see sf::RenderQueue, sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Per-frame statistics and GPU timings of render targets
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderProfiler : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics of a single frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct FrameStats
+    {
+        std::uint64_t index{0};            //!< Number of the frame, the first one is 0
+        Time          start;               //!< Start of the frame, relative to the creation of the profiler
+        Time          cpuTime;             //!< Time elapsed between beginFrame and endFrame
+        Time          gpuTime;             //!< Time spent by the graphics card on the frame
+        bool          hasGpuTime{false};   //!< Has gpuTime been measured (it is known a few frames later)?
+        std::size_t   drawCalls{0};        //!< Number of primitives drawn (glDrawArrays calls)
+        std::size_t   vertices{0};         //!< Number of vertices drawn
+        std::size_t   textureChanges{0};   //!< Number of texture bindings
+        std::size_t   blendModeChanges{0}; //!< Number of blend mode changes
+        std::size_t   shaderChanges{0};    //!< Number of shader bindings (including unbinding)
+        std::size_t   textureUploads{0};   //!< Number of pixel uploads to textures
+        std::size_t   uploadedBytes{0};    //!< Number of bytes uploaded to textures
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the profiler
+    ///
+    /// \param historySize Number of finished frames to keep
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit RenderProfiler(std::size_t historySize = 300);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderProfiler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderProfiler(const RenderProfiler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderProfiler& operator=(const RenderProfiler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording a new frame
+    ///
+    /// The counters are reset, and a GPU timer is started if
+    /// timer queries are supported. The context of the render
+    /// target that is profiled must be active: GPU timings are
+    /// only measured in the context used for the first frame.
+    ///
+    /// \see endFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop recording the current frame and add it to the history
+    ///
+    /// The GPU time of a frame is not known until the graphics
+    /// card has finished rendering it: it is filled in by a
+    /// later call to endFrame, without ever stalling.
+    ///
+    /// \see beginFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of finished frames in the history
+    ///
+    /// \return Number of frames
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getFrameCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of a finished frame
+    ///
+    /// \param index Index of the frame in the history, 0 is the oldest
+    ///
+    /// \return Statistics of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    const FrameStats& getFrame(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the history to a file in the Chrome trace event format
+    ///
+    /// The file can be loaded in chrome://tracing or in
+    /// Perfetto. Every frame is an event on the "CPU" track,
+    /// with its statistics as arguments, and its GPU time is
+    /// an event of the "GPU" track starting at the same time.
+    ///
+    /// \param filename Path of the file to write
+    ///
+    /// \return True if saving was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveChromeTrace(const std::filesystem::path& filename) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports GPU timer queries
+    ///
+    /// If it returns false, frames never get a GPU time.
+    ///
+    /// \return True if timer queries are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isGpuTimingAvailable();
+
+private:
+    friend class RenderTarget;
+    friend class Texture;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record an upload of pixels to a texture
+    ///
+    /// Uploads are counted for the whole process, whatever
+    /// the thread or the render target they are meant for.
+    ///
+    /// \param bytes Number of uploaded bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    static void countTextureUpload(std::size_t bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the results of the finished timer queries
+    ///
+    /// \param wait Block until the oldest query is finished?
+    ///
+    ////////////////////////////////////////////////////////////
+    void retrieveGpuTimes(bool wait);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Timer query in flight
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Query
+    {
+        unsigned int  query{0}; //!< OpenGL handle of the query
+        std::uint64_t frame{0}; //!< Index of the measured frame
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Clock                     m_clock;             //!< Clock measuring the frames
+    std::size_t               m_historySize;       //!< Maximum number of frames kept in the history
+    std::deque<FrameStats>    m_frames;            //!< Finished frames, oldest first
+    FrameStats                m_current;           //!< Frame being recorded; RenderTarget updates its counters
+    bool                      m_recording{false};  //!< Is a frame being recorded?
+    std::uint64_t             m_uploadsAtStart{0}; //!< Process-wide upload count at the start of the frame
+    std::uint64_t             m_bytesAtStart{0};   //!< Process-wide uploaded bytes at the start of the frame
+    std::uint64_t             m_contextId{0};      //!< Context owning the timer queries
+    unsigned int              m_activeQuery{0};    //!< Query measuring the current frame, if any
+    std::deque<Query>         m_pendingQueries;    //!< Queries waiting for their result, oldest first
+    std::vector<unsigned int> m_freeQueries;       //!< Queries ready to be reused
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderProfiler
+/// \ingroup graphics
+///
+/// sf::RenderProfiler measures where the time of a frame goes
+/// inside SFML. Once attached to a render target, it counts the
+/// draw calls, vertices and state changes issued by the target,
+/// and the texture uploads of the whole process. When timer
+/// queries are supported (OpenGL 3.3), it also measures the time
+/// spent by the graphics card on each frame.
+///
+/// Frames are delimited explicitly by beginFrame and endFrame,
+/// and kept in a history of fixed size which can be inspected
+/// through getFrame, or saved as a Chrome trace with
+/// saveChromeTrace for offline analysis.
+///
+/// State changes are only counted when the render target
+/// actually changes the OpenGL state: redundant changes are
+/// filtered out by its cache, and don't show up here.
+///
+/// Usage example:
+/// \code
+/// sf::RenderWindow window(sf::VideoMode({800, 600}), "SFML window");
+/// sf::RenderProfiler profiler;
+/// window.setProfiler(&profiler);
+///
+/// while (window.isOpen())
+/// {
+///     profiler.beginFrame();
+///
+///     window.clear();
+///     window.draw(...);
+///
+///     profiler.endFrame();
+///     window.display();
+///
+///     const auto& frame = profiler.getFrame(profiler.getFrameCount() - 1);
+///     std::cout << frame.drawCalls << " draw calls" << std::endl;
+/// }
+///
+/// if (!profiler.saveChromeTrace("frames.json"))
+/// {
+///     // error...
+/// }
+/// \endcode
+///
+/// \see sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,333 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+namespace sf
+{
+class IndexBuffer;
+class RenderTarget;
+class Shader;
+class VertexBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Deferred draw commands, sorted by render states before execution
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderQueue
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the layer of the next commands
+    ///
+    /// Layers are always executed in increasing order, commands
+    /// are only reordered within a layer. The default layer is 0.
+    ///
+    /// \param layer New current layer
+    ///
+    /// \see getLayer, setLayerOrdered
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayer(std::uint8_t layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the next commands
+    ///
+    /// \return Current layer
+    ///
+    /// \see setLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint8_t getLayer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose whether a layer preserves the submission order
+    ///
+    /// The commands of an ordered layer are executed in the order
+    /// they were submitted, which is required when overlapping
+    /// geometry is blended. Commands of an unordered layer (the
+    /// default) are sorted by shader, texture, blend mode and
+    /// primitive type, which minimizes state changes and lets
+    /// consecutive compatible commands be merged.
+    ///
+    /// \param layer   Layer to change
+    /// \param ordered True to preserve the submission order
+    ///
+    /// \see isLayerOrdered
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayerOrdered(std::uint8_t layer, bool ordered);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a layer preserves the submission order
+    ///
+    /// \param layer Layer to check
+    ///
+    /// \return True if the layer is ordered, false otherwise
+    ///
+    /// \see setLayerOrdered
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isLayerOrdered(std::uint8_t layer) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue primitives defined by an array of vertices
+    ///
+    /// The vertices are copied, so the array doesn't have to
+    /// outlive the call. They are transformed by \a states.transform
+    /// right away, and strips and fans are converted to lists so
+    /// that they can be merged with other commands.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*       vertices,
+              std::size_t         vertexCount,
+              PrimitiveType       type,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue primitives defined by an array of indexed vertices
+    ///
+    /// The indexed vertices are expanded when they are copied,
+    /// so that the command can be merged with non-indexed ones.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices of the vertices to draw
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint32_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue primitives defined by a vertex buffer
+    ///
+    /// Only a reference to the vertex buffer is stored, it must
+    /// stay alive and unchanged until the queue is flushed.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param firstVertex  Index of the first vertex to render
+    /// \param vertexCount  Number of vertices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              std::size_t         firstVertex,
+              std::size_t         vertexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue primitives defined by a vertex buffer and an index buffer
+    ///
+    /// Only references to the buffers are stored, they must stay
+    /// alive and unchanged until the queue is flushed.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Indices of the vertices to draw
+    /// \param firstIndex   Index of the first index to use
+    /// \param indexCount   Number of indices to use
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue all the commands of another queue
+    ///
+    /// The commands are appended in their submission order and
+    /// keep their layer. Whether their layer is ordered is decided
+    /// by this queue. Vertices are copied, vertex buffers are still
+    /// only referenced.
+    ///
+    /// This is how command buffers recorded on different threads
+    /// are gathered before being flushed in a single pass.
+    ///
+    /// \param queue Queue to copy the commands from (must not be this queue)
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const RenderQueue& queue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of queued commands
+    ///
+    /// \return Number of commands waiting to be flushed
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCommandCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard all queued commands
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort and execute all queued commands, then clear the queue
+    ///
+    /// If \a target redirects its draws to this queue, the
+    /// redirection is suspended while the commands execute. If it
+    /// redirects them to another queue (for example when \a target
+    /// is a sf::RenderCommandBuffer), the merged batches are
+    /// recorded to that queue instead.
+    ///
+    /// \param target Render target to draw to
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush(RenderTarget& target);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Deferred draw command
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        std::uint64_t       key;          //!< Sort key
+        RenderStates        states;       //!< Render states (identity transform for vertex arrays)
+        PrimitiveType       type;         //!< Type of primitives to draw
+        std::size_t         firstVertex;  //!< Index of the first vertex (or index, with an index buffer) to draw
+        std::size_t         vertexCount;  //!< Number of vertices (or indices, with an index buffer) to draw
+        const VertexBuffer* vertexBuffer; //!< Vertex buffer to draw from, null for queued vertices
+        const IndexBuffer*  indexBuffer;  //!< Index buffer of the vertex buffer, if any
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the sort key of a command
+    ///
+    /// \param states Render states of the command
+    /// \param type   Type of primitives of the command
+    ///
+    /// \return Sort key
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t makeKey(const RenderStates& states, PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort the commands by key, preserving the order of equal keys
+    ///
+    ////////////////////////////////////////////////////////////
+    void sortCommands();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::uint8_t                                     m_layer{0};      //!< Layer of the next commands
+    std::bitset<256>                                 m_orderedLayers; //!< Layers preserving the submission order
+    std::vector<Command>                             m_commands;      //!< Queued commands, in submission order
+    std::vector<Vertex>                              m_vertices;      //!< Transformed vertices of the queued commands
+    std::vector<std::uint32_t>                       m_order;         //!< Indices of the commands, in execution order
+    std::vector<std::uint32_t>                       m_sortBuffer;    //!< Scratch buffer of the radix sort
+    std::vector<Vertex>                              m_batch;         //!< Scratch buffer for merging or expanding draws
+    std::vector<const Shader*>                       m_shaders;       //!< Shaders referenced by the queued commands
+    std::unordered_map<std::uint64_t, std::uint32_t> m_textures;      //!< Dense indices of the referenced textures
+    std::vector<BlendMode>                           m_blendModes;    //!< Blend modes referenced by the queued commands
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderQueue
+/// \ingroup graphics
+///
+/// sf::RenderTarget executes draw calls immediately, in the
+/// order they are issued. When textures, shaders and blend
+/// modes are interleaved (tiles, entities, UI...), every draw
+/// changes the OpenGL states and the render target's cache
+/// can't help.
+///
+/// sf::RenderQueue records draw commands instead, and sorts
+/// them by render states before executing them. Consecutive
+/// commands sharing the same states are then merged into a
+/// single draw call.
+///
+/// Sorting changes the drawing order, which matters when
+/// overlapping geometry is blended. Commands are therefore
+/// organized in layers: layers are drawn one after the other
+/// in increasing order, and a layer can be marked as ordered
+/// to keep its commands in submission order.
+///
+/// Any drawable can be queued by redirecting the draws of a
+/// render target to the queue with RenderTarget::setRenderQueue.
+///
+/// Usage example:
+/// \code
+/// sf::RenderQueue queue;
+/// queue.setLayerOrdered(2, true); // UI is blended, keep it in order
+///
+/// window.setRenderQueue(&queue);
+///
+/// queue.setLayer(0);
+/// for (const auto& tile : tiles)
+///     window.draw(tile);
+///
+/// queue.setLayer(1);
+/// for (const auto& entity : entities)
+///     window.draw(entity);
+///
+/// queue.setLayer(2);
+/// window.draw(hud);
+///
+/// queue.flush(window);
+/// window.display();
+/// \endcode
+///
+/// Draws can also be recorded on other threads with
+/// sf::RenderCommandBuffer, and gathered with append.
+///
+/// \see sf::RenderTarget, sf::RenderCommandBuffer
+///
+////////////////////////////////////////////////////////////
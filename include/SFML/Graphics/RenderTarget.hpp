@@ -38,11 +38,22 @@
 #include <SFML/Graphics/View.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 
 
 namespace sf
 {
+namespace priv
+{
+class CoreRenderer;
+class VertexStream;
+}
+
 class Drawable;
+class IndexBuffer;
+class RenderProfiler;
+class RenderQueue;
 class VertexBuffer;
 class Transform;
 
@@ -262,6 +273,28 @@ public:
               PrimitiveType       type,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of indexed vertices
+    ///
+    /// The primitives are assembled from the vertices referenced
+    /// by \a indices, which lets them share vertices: a quad only
+    /// needs 4 vertices with 6 indices as a triangle list.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices of the vertices to draw
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint32_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
@@ -285,6 +318,88 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Indices of the vertices to draw
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and a range of an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Indices of the vertices to draw
+    /// \param firstIndex   Index of the first index to use
+    /// \param indexCount   Number of indices to use
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Redirect the draws of the render target to a render queue
+    ///
+    /// While a render queue is set, the draw functions record
+    /// commands into the queue instead of drawing immediately;
+    /// they are executed when the queue is flushed. Pass a null
+    /// pointer to draw immediately again.
+    ///
+    /// The queue must stay alive as long as it is set.
+    ///
+    /// \param queue Render queue to record draws into, or null
+    ///
+    /// \see getRenderQueue
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRenderQueue(RenderQueue* queue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the render queue the draws are redirected to
+    ///
+    /// \return Current render queue, or null if draws are immediate
+    ///
+    /// \see setRenderQueue
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderQueue* getRenderQueue() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a profiler to the render target
+    ///
+    /// The profiler counts the draw calls, vertices and state
+    /// changes issued by the render target. A profiler can be
+    /// shared by several render targets. Pass a null pointer
+    /// to stop profiling.
+    ///
+    /// The profiler must stay alive as long as it is attached.
+    ///
+    /// \param profiler Profiler to attach, or null
+    ///
+    /// \see getProfiler
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProfiler(RenderProfiler* profiler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the profiler attached to the render target
+    ///
+    /// \return Attached profiler, or null if the target is not profiled
+    ///
+    /// \see setProfiler
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderProfiler* getProfiler() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -446,6 +561,24 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw an array of vertices, indexed or not
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices, or null to draw the vertices in order
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex*        vertices,
+                      std::size_t          vertexCount,
+                      const std::uint32_t* indices,
+                      std::size_t          indexCount,
+                      PrimitiveType        type,
+                      const RenderStates&  states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -465,6 +598,17 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives
+    ///
+    /// \param type       Type of primitives to draw
+    /// \param indices    Pointer to the indices, or offset in the bound index buffer
+    /// \param indexCount Number of indices to use when drawing
+    /// \param baseVertex Index of the vertex that index 0 refers to (core profile only)
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, const void* indices, std::size_t indexCount, std::size_t baseVertex);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -497,10 +641,14 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache;       //!< Render states cache
-    std::uint64_t m_id{0};       //!< Unique number that identifies the RenderTarget
+    View                                m_defaultView;       //!< Default view
+    View                                m_view;              //!< Current view
+    StatesCache                         m_cache;             //!< Render states cache
+    std::uint64_t                       m_id{0};             //!< Unique number that identifies the RenderTarget
+    RenderQueue*                        m_queue{nullptr};    //!< Render queue the draws are redirected to, if any
+    RenderProfiler*                     m_profiler{nullptr}; //!< Profiler counting the draws and state changes, if any
+    std::unique_ptr<priv::CoreRenderer> m_coreRenderer;      //!< Backend used with core profile contexts, if any
+    std::unique_ptr<priv::VertexStream> m_vertexStream;      //!< Streaming buffer for large immediate-mode draws
 };
 
 } // namespace sf
@@ -528,6 +676,20 @@ private:
 /// OpenGL states are not messed up by calling the
 /// pushGLStates/popGLStates functions.
 ///
+/// When the context is an OpenGL 3.3 (or newer) core profile
+/// context, which can be requested through sf::ContextSettings
+/// (attributeFlags = sf::ContextSettings::Core, majorVersion = 3,
+/// minorVersion = 3), render targets detect it on their first draw
+/// and switch to a backend that doesn't rely on the deprecated
+/// fixed-function pipeline: a built-in shader program, a vertex
+/// array object and a streaming vertex buffer. Shaders used with
+/// such contexts must read the vertex attributes from locations
+/// 0 (position), 1 (color) and 2 (texture coordinates); the uniforms
+/// sf_projection, sf_modelView and sf_textureMatrix (mat4) are set
+/// by SFML if the shader declares them. Note that sf::Shader
+/// itself requires the ARB shader object extensions, which are
+/// seldom exposed by core profile contexts.
+///
 /// \see sf::RenderWindow, sf::RenderTexture, sf::View
 ///
 ////////////////////////////////////////////////////////////
@@ -31,9 +31,13 @@
 
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Transformable.hpp>
-#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 
 namespace sf
 {
@@ -213,6 +217,21 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Vector2f getPoint(std::size_t index) const = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the shape
+    ///
+    /// The points are in local coordinates, like the ones
+    /// returned by getPoint. The default implementation calls
+    /// getPoint for each point; derived classes can override it
+    /// to compute all their points in a single virtual call.
+    ///
+    /// \param points Array receiving the points, must have room for getPointCount() elements
+    ///
+    /// \see getPoint, getPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void getPoints(Vector2f* points) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the local bounding rectangle of the entity
     ///
@@ -262,6 +281,10 @@ protected:
     /// the shape's points change (i.e. the result of either
     /// getPointCount or getPoint is different).
     ///
+    /// The geometry is recomputed right away, like it is by the
+    /// setters of the shape's attributes, so that drawing the
+    /// shape or getting its bounds never modifies it.
+    ///
     ////////////////////////////////////////////////////////////
     void update();
 
@@ -275,6 +298,12 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, const RenderStates& states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' position
+    ///
+    ////////////////////////////////////////////////////////////
+    void updatePoints();
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
@@ -303,15 +332,16 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Texture* m_texture{nullptr};           //!< Texture of the shape
-    IntRect        m_textureRect;                //!< Rectangle defining the area of the source texture to display
-    Color          m_fillColor{Color::White};    //!< Fill color
-    Color          m_outlineColor{Color::White}; //!< Outline color
-    float          m_outlineThickness{0};        //!< Thickness of the shape's outline
-    VertexArray    m_vertices{PrimitiveType::TriangleFan};          //!< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices{PrimitiveType::TriangleStrip}; //!< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;                                  //!< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds; //!< Bounding rectangle of the whole shape (outline + fill)
+    const Texture*             m_texture{nullptr};           //!< Texture of the shape
+    IntRect                    m_textureRect;                //!< Area of the source texture to display
+    Color                      m_fillColor{Color::White};    //!< Fill color
+    Color                      m_outlineColor{Color::White}; //!< Outline color
+    float                      m_outlineThickness{0};        //!< Thickness of the shape's outline
+    std::vector<Vertex>        m_vertices;                   //!< Center, points, then outline vertices
+    std::vector<std::uint32_t> m_indices;                    //!< Fill, then outline triangles
+    std::size_t                m_pointCount{0};              //!< Number of points of the geometry
+    FloatRect                  m_insideBounds;               //!< Bounding rectangle of the inside (fill)
+    FloatRect                  m_bounds;                     //!< Bounding rectangle of the outline and fill
 };
 
 } // namespace sf
@@ -345,6 +375,14 @@ private:
 /// \li getPointCount must return the number of points of the shape
 /// \li getPoint must return the points of the shape
 ///
+/// Overriding getPoints as well is optional, it avoids one
+/// virtual call per point when the geometry is rebuilt.
+///
+/// The vertices are rebuilt lazily, and only the attributes
+/// that changed are: changing the fill color doesn't touch the
+/// positions, changing the outline thickness doesn't touch the
+/// fill, and so on.
+///
 /// \see sf::RectangleShape, sf::CircleShape, sf::ConvexShape, sf::Transformable
 ///
 ////////////////////////////////////////////////////////////
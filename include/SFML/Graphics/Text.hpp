@@ -32,9 +32,11 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Transformable.hpp>
-#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/String.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -427,20 +429,21 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    String                m_string;                                    //!< String to display
-    const Font*           m_font{nullptr};                             //!< Font used to display the string
-    unsigned int          m_characterSize{30};                         //!< Base size of characters, in pixels
-    float                 m_letterSpacingFactor{1.f};                  //!< Spacing factor between letters
-    float                 m_lineSpacingFactor{1.f};                    //!< Spacing factor between lines
-    std::uint32_t         m_style{Regular};                            //!< Text style (see Style enum)
-    Color                 m_fillColor{Color::White};                   //!< Text fill color
-    Color                 m_outlineColor{Color::Black};                //!< Text outline color
-    float                 m_outlineThickness{0.f};                     //!< Thickness of the text's outline
-    mutable VertexArray   m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
-    mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
-    mutable FloatRect     m_bounds;                    //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool          m_geometryNeedUpdate{false}; //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t m_fontTextureId{0};          //!< The font texture id
+    String                             m_string;                     //!< String to display
+    const Font*                        m_font{nullptr};              //!< Font used to display the string
+    unsigned int                       m_characterSize{30};          //!< Base size of characters, in pixels
+    float                              m_letterSpacingFactor{1.f};   //!< Spacing factor between letters
+    float                              m_lineSpacingFactor{1.f};     //!< Spacing factor between lines
+    std::uint32_t                      m_style{Regular};             //!< Text style (see Style enum)
+    Color                              m_fillColor{Color::White};    //!< Text fill color
+    Color                              m_outlineColor{Color::Black}; //!< Text outline color
+    float                              m_outlineThickness{0.f};      //!< Thickness of the text's outline
+    mutable std::vector<Vertex>        m_vertices;                   //!< Quads of the outline, then of the fill
+    mutable std::size_t                m_outlineVertexCount{0};      //!< Number of vertices of the outline quads
+    mutable std::vector<std::uint32_t> m_indices;                    //!< Triangles of the quads, 6 indices per quad
+    mutable FloatRect                  m_bounds;                     //!< Local bounding rectangle of the text
+    mutable bool                       m_geometryNeedUpdate{false};  //!< Does the geometry need to be recomputed?
+    mutable std::uint64_t              m_fontTextureId{0};           //!< The font texture id
 };
 
 } // namespace sf
@@ -581,7 +581,9 @@ public:
 private:
     friend class Text;
     friend class RenderTexture;
+    friend class RenderQueue;
     friend class RenderTarget;
+    friend class TextureStreamer;
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
@@ -607,6 +609,20 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload pixels to a part of the texture
+    ///
+    /// Unlike update, \a pixels is not checked against null:
+    /// when a pixel unpack buffer is bound, it is interpreted
+    /// as a byte offset into that buffer.
+    ///
+    /// \param pixels Array of pixels (or offset) to copy to the texture
+    /// \param size   Width and height of the pixel region
+    /// \param dest   Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadPixels(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
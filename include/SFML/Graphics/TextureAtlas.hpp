@@ -0,0 +1,264 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <vector>
+
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Packs many images into a few large textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// \param pageSize Initial size of the page textures, pages
+    ///                 grow up to the maximum texture size
+    /// \param padding  Width of the gutter added around each image, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureAtlas(const Vector2u& pageSize = {512, 512}, unsigned int padding = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// The image is copied to the first page that has room for
+    /// it, growing the page texture or creating a new page if
+    /// needed. The gutter around the image is filled with its
+    /// edge pixels, so that smooth filtering and the first
+    /// mipmap levels don't bleed neighbouring images into it.
+    ///
+    /// Existing handles, texture rectangles and page textures
+    /// stay valid when images are added.
+    ///
+    /// \param image Image to add
+    ///
+    /// \return Handle of the new image, or std::nullopt if it could not be added
+    ///
+    /// \see getTexture, getTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<std::size_t> add(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture containing an image of the atlas
+    ///
+    /// \param handle Handle of the image, as returned by add
+    ///
+    /// \return Texture of the page containing the image
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTexture(std::size_t handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of an image in its page texture
+    ///
+    /// The returned rectangle excludes the gutter and can be
+    /// passed directly to sf::Sprite::setTextureRect.
+    ///
+    /// \param handle Handle of the image, as returned by add
+    ///
+    /// \return Rectangle of the image in the texture returned by getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect getTextureRect(std::size_t handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of images in the atlas
+    ///
+    /// \return Number of images
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getImageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of page textures
+    ///
+    /// \return Number of pages
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a page texture
+    ///
+    /// \param index Index of the page, in range [0 .. getPageCount() - 1]
+    ///
+    /// \return Texture of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getPage(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter on all pages
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Generate a mipmap for all pages
+    ///
+    /// Adding images to the atlas invalidates the mipmap,
+    /// call this function again once all images are added.
+    ///
+    /// \return True if the mipmaps were successfully generated, false otherwise
+    ///
+    /// \see Texture::generateMipmap
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool generateMipmap();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure defining a row of images
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Row
+    {
+        Row(unsigned int rowTop, unsigned int rowHeight) : top(rowTop), height(rowHeight)
+        {
+        }
+
+        unsigned int width{0}; //!< Current width of the row
+        unsigned int top;      //!< Y position of the row into the texture
+        unsigned int height;   //!< Height of the row
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure defining a page of images
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Page
+    {
+        Texture          texture;    //!< Texture containing the pixels of the images
+        unsigned int     nextRow{0}; //!< Y position of the next new row in the texture
+        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure locating an image in the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Region
+    {
+        std::size_t page; //!< Index of the page containing the image
+        IntRect     rect; //!< Rectangle of the image in the page texture (excluding the gutter)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a suitable rectangle within a page
+    ///
+    /// \param page Page to search in
+    /// \param size Size of the rectangle, gutter included
+    ///
+    /// \return Found rectangle, or std::nullopt if the page is full
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<IntRect> findRect(Page& page, const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u            m_pageSize;        //!< Initial size of the page textures
+    unsigned int        m_padding;         //!< Width of the gutter around each image
+    bool                m_isSmooth{false}; //!< Status of the smooth filter
+    std::deque<Page>    m_pages;           //!< Pages of the atlas (a deque keeps references stable)
+    std::vector<Region> m_regions;         //!< Location of each image, indexed by handle
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// sf::TextureAtlas packs many small images into a few large
+/// textures (pages). Drawing sprites that share a texture
+/// doesn't require the render target to bind a new texture
+/// for every sprite, which makes a big difference when
+/// thousands of them are drawn every frame.
+///
+/// Images are added one by one at any time, the atlas
+/// returns a handle for each of them. The handle gives
+/// access to the page texture and to the rectangle of the
+/// image within it, ready to be used with a sprite.
+///
+/// Each image is surrounded by a gutter filled with copies
+/// of its edge pixels, so that smooth filtering doesn't pick
+/// up pixels of neighbouring images. A gutter of N pixels
+/// protects roughly log2(N) + 1 mipmap levels.
+///
+/// Usage example:
+/// \code
+/// sf::TextureAtlas atlas;
+///
+/// sf::Image heroImage, enemyImage;
+/// ...
+/// std::optional<std::size_t> hero  = atlas.add(heroImage);
+/// std::optional<std::size_t> enemy = atlas.add(enemyImage);
+/// if (!hero || !enemy)
+///     return -1;
+///
+/// sf::Sprite sprite(atlas.getTexture(*hero), atlas.getTextureRect(*hero));
+/// window.draw(sprite);
+/// \endcode
+///
+/// \see sf::Texture, sf::Sprite
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+
+namespace sf
+{
+class Image;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Asynchronous pixel transfers between system memory and textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureStreamer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the streamer
+    ///
+    /// \param bufferCount Number of staging buffers in the upload
+    ///                    ring, also the maximum number of pending copies
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureStreamer(std::size_t bufferCount = 3);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureStreamer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole texture from an array of pixels
+    ///
+    /// The \a pixel array is assumed to have the same size as
+    /// the texture, and to contain 32-bits RGBA pixels.
+    ///
+    /// \param texture Texture to update
+    /// \param pixels  Array of pixels to copy to the texture
+    ///
+    /// \return True if the update was queued, false if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(Texture& texture, const std::uint8_t* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of pixels
+    ///
+    /// The pixels are copied to the next staging buffer of the
+    /// ring and the transfer to the texture is left to the
+    /// graphics card: the function returns as soon as the
+    /// pixel array has been copied, and \a pixels can be
+    /// reused right away. A staging buffer which is still in
+    /// use by a previous transfer is reallocated by the driver
+    /// instead of waiting for the transfer to complete.
+    ///
+    /// If pixel buffer objects are not supported, this function
+    /// falls back to a regular (synchronous) Texture::update.
+    ///
+    /// No additional check is performed on the size of the pixel
+    /// array or the bounds of the area to update, passing invalid
+    /// arguments will lead to an undefined behavior.
+    ///
+    /// \param texture Texture to update
+    /// \param pixels  Array of pixels to copy to the texture
+    /// \param size    Width and height of the pixel region contained in \a pixels
+    /// \param dest    Coordinates of the destination position
+    ///
+    /// \return True if the update was queued, false if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(Texture& texture, const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the pixels of a texture to system memory
+    ///
+    /// The copy is performed by the graphics card in the
+    /// background, call retrieveCopy later to get the result.
+    /// Copies are retrieved in the order they were requested.
+    ///
+    /// This function fails if pixel buffer objects are not
+    /// supported, if the texture is empty or if the number of
+    /// pending copies already matches the number of buffers
+    /// given at construction.
+    ///
+    /// \param texture Texture to copy
+    ///
+    /// \return True if the copy was started, false if it failed
+    ///
+    /// \see retrieveCopy, getPendingCopyCount
+    ///
+    ////////////////////////////////////////////////////////////
+    bool requestCopy(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the oldest pending copy
+    ///
+    /// If \a wait is false and the graphics card has not
+    /// finished the copy yet, this function returns false
+    /// immediately and the copy stays pending. If fences
+    /// are not supported by the driver, a copy is always
+    /// considered finished, and retrieving it may block.
+    ///
+    /// \param image Image to fill with the copied pixels
+    /// \param wait  Block until the copy is finished?
+    ///
+    /// \return True if \a image was filled, false otherwise
+    ///
+    /// \see requestCopy
+    ///
+    ////////////////////////////////////////////////////////////
+    bool retrieveCopy(Image& image, bool wait = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of copies waiting to be retrieved
+    ///
+    /// \return Number of pending copies
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPendingCopyCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports pixel buffer objects
+    ///
+    /// This function should always be called before using
+    /// the asynchronous features. If it returns false, then
+    /// any attempt to use requestCopy will fail and update
+    /// will be synchronous.
+    ///
+    /// \return True if pixel buffer objects are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Staging buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Buffer
+    {
+        unsigned int buffer{0};   //!< Internal buffer identifier
+        std::size_t  capacity{0}; //!< Size in bytes of the allocated storage
+        void*        fence{};     //!< Fence signaled when the graphics card is done with the buffer
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy of a texture in progress
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Copy
+    {
+        Buffer   staging;              //!< Buffer receiving the pixels
+        Vector2u size;                 //!< Public size of the copied texture
+        Vector2u actualSize;           //!< Actual size of the copied texture (including padding)
+        bool     pixelsFlipped{false}; //!< Are the copied pixels flipped vertically?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy a staging buffer and its fence
+    ///
+    /// \param buffer Buffer to destroy
+    ///
+    ////////////////////////////////////////////////////////////
+    static void destroy(Buffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Buffer> m_uploadBuffers;   //!< Ring of staging buffers for uploads
+    std::size_t         m_nextUpload{0};   //!< Index of the next upload buffer to use
+    std::deque<Copy>    m_copies;          //!< Pending copies, oldest first
+    std::vector<Buffer> m_readbackBuffers; //!< Staging buffers of retrieved copies, ready to be reused
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureStreamer
+/// \ingroup graphics
+///
+/// sf::TextureStreamer moves pixels between system memory
+/// and textures without stalling the calling thread, using
+/// pixel buffer objects as staging memory.
+///
+/// Texture::update copies the pixels straight from system
+/// memory, which means that the driver has to finish with
+/// them before the function returns. Texture::copyToImage
+/// is worse: it waits for the graphics card to complete all
+/// pending rendering before it can read the texture back.
+/// When large textures are streamed every frame (video frames,
+/// tiles of a big map, screenshots...) these stalls quickly
+/// become the bottleneck.
+///
+/// sf::TextureStreamer keeps a small ring of staging buffers.
+/// An update only copies the pixels to the next buffer and
+/// lets the graphics card transfer them to the texture in the
+/// background. A copy works the other way around: requestCopy
+/// starts the transfer to a staging buffer, and retrieveCopy
+/// gets the resulting image a few frames later, once the
+/// transfer is complete.
+///
+/// A single streamer can be used with any number of textures.
+///
+/// Usage example:
+/// \code
+/// sf::Texture texture;
+/// if (!texture.create({3840, 2160}))
+///     return -1;
+///
+/// sf::TextureStreamer streamer;
+///
+/// while (...) // the main loop
+/// {
+///     ...
+///
+///     // upload the latest video frame without waiting for the transfer
+///     streamer.update(texture, frame.pixels);
+///
+///     // start a screenshot when requested...
+///     if (screenshotRequested)
+///         streamer.requestCopy(texture);
+///
+///     // ...and save it once it's ready
+///     sf::Image screenshot;
+///     if (streamer.retrieveCopy(screenshot))
+///         screenshot.saveToFile("screenshot.png");
+///
+///     // draw it
+///     window.draw(sprite);
+///     ...
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::Image
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of tiles taken from a tileset texture,
+///        drawn by chunks
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a tile in the tileset
+    ///
+    /// Tiles are numbered from left to right, then from top to
+    /// bottom, starting at 0 for the top-left tile of the
+    /// tileset texture.
+    ///
+    ////////////////////////////////////////////////////////////
+    using TileId = std::uint16_t;
+
+    static constexpr TileId EmptyTile = 0xFFFF; //!< Special identifier of cells that have no tile
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty tile map
+    ///
+    /// All the cells of the map are initially empty.
+    ///
+    /// \param tileset   Texture containing the tiles, side by side
+    /// \param tileSize  Size of a tile, in pixels (both in the tileset and in the map)
+    /// \param size      Number of columns and rows of the map
+    /// \param chunkSize Number of columns and rows of tiles drawn by a single chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture& tileset, const Vector2u& tileSize, const Vector2u& size, unsigned int chunkSize = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset texture
+    ///
+    /// The texture must exist as long as the tile map uses it.
+    /// Its size may differ from the previous tileset, the tile
+    /// identifiers of the map are kept.
+    ///
+    /// \param tileset New tileset texture
+    ///
+    /// \see getTileset
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Texture& tileset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset texture
+    ///
+    /// \return Reference to the tileset texture
+    ///
+    /// \see setTileset
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTileset() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Number of columns and rows of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tile of a cell
+    ///
+    /// Only the chunk containing the cell is rebuilt, the next
+    /// time it is visible.
+    ///
+    /// \param cell Column and row of the cell
+    /// \param tile New tile of the cell, or EmptyTile to clear it
+    ///
+    /// \see getTile, setTiles
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(const Vector2u& cell, TileId tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tiles of all the cells
+    ///
+    /// \param tiles Array of getSize().x * getSize().y tiles, row by row
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTiles(const TileId* tiles);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tile of a cell
+    ///
+    /// \param cell Column and row of the cell
+    ///
+    /// \return Tile of the cell, or EmptyTile if it is empty
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    TileId getTile(const Vector2u& cell) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Animate a tile
+    ///
+    /// All the cells containing \a tile display the frames in
+    /// turn, each for \a frameDuration, in a loop. The tile
+    /// identifiers of the cells don't change, only the part of
+    /// the tileset they display. Passing an empty list of
+    /// frames stops the animation of the tile.
+    ///
+    /// \param tile          Tile to animate
+    /// \param frames        Tiles to display in turn
+    /// \param frameDuration Duration of each frame
+    ///
+    /// \see update, getDisplayedTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAnimation(TileId tile, const std::vector<TileId>& frames, Time frameDuration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advance the animations of the tiles
+    ///
+    /// Only the chunks containing animated tiles are rebuilt,
+    /// and only when a frame actually changes.
+    ///
+    /// \param elapsed Time elapsed since the last update
+    ///
+    /// \see setAnimation
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tile displayed by the cells containing a tile
+    ///
+    /// This is the current frame of the animation of \a tile,
+    /// or \a tile itself if it is not animated.
+    ///
+    /// \param tile Tile contained by the cells
+    ///
+    /// \return Tile of the tileset displayed by the cells
+    ///
+    /// \see setAnimation, update
+    ///
+    ////////////////////////////////////////////////////////////
+    TileId getDisplayedTile(TileId tile) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the map
+    ///
+    /// \return Local bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the map
+    ///
+    /// \return Global bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks of the map to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const RenderStates& states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Block of tiles drawn with a single draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        VertexBuffer        buffer{PrimitiveType::Triangles, VertexBuffer::Static}; //!< Vertices of the tiles
+        std::vector<Vertex> vertices;          //!< Vertices of the tiles, when vertex buffers are not available
+        std::size_t         tileCount{0};      //!< Number of non-empty tiles
+        bool                needUpdate{true};  //!< Do the vertices need to be rebuilt?
+        bool                inBuffer{false};   //!< Were the vertices built for the vertex buffer?
+        bool                isAnimated{false}; //!< Does the chunk contain animated tiles?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Animation of a tile
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Animation
+    {
+        TileId              tile;          //!< Animated tile
+        std::vector<TileId> frames;        //!< Tiles displayed in turn
+        Time                frameDuration; //!< Duration of each frame
+        Time                elapsed;       //!< Time spent in the current loop of the animation
+        std::size_t         frame{0};      //!< Index of the current frame
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the vertices of a chunk
+    ///
+    /// \param chunkCell  Column and row of the chunk
+    /// \param chunk      Chunk to rebuild
+    /// \param useBuffers True to upload the vertices to the vertex buffer of the chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(const Vector2u& chunkCell, Chunk& chunk, bool useBuffers) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark all the chunks, or only the animated ones, for rebuilding
+    ///
+    /// \param animatedOnly True to only mark the chunks that contain animated tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateChunks(bool animatedOnly);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*                     m_tileset;                          //!< Texture containing the tiles
+    Vector2u                           m_tileSize;                         //!< Size of a tile, in pixels
+    Vector2u                           m_size;                             //!< Number of columns and rows of the map
+    unsigned int                       m_chunkSize;                        //!< Number of columns and rows of a chunk
+    Vector2u                           m_chunkCount;                       //!< Number of columns and rows of chunks
+    std::vector<TileId>                m_tiles;                            //!< Tile of each cell, row by row
+    std::vector<Animation>             m_animations;                       //!< Animations of the animated tiles
+    std::vector<TileId>                m_displayedTiles;                   //!< Tile displayed instead of each tile
+    std::vector<bool>                  m_animatedTiles;                    //!< Is each tile animated?
+    mutable std::vector<Chunk>         m_chunks;                           //!< Chunks of the map, row by row
+    mutable IndexBuffer                m_indexBuffer{IndexBuffer::Static}; //!< Indices of the quads of a full chunk
+    mutable std::vector<std::uint32_t> m_indices;                          //!< Indices of the quads of a full chunk
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap draws a rectangular grid of cells, each one
+/// showing a tile of a tileset texture (or nothing). It
+/// stores a compact 16-bit tile identifier per cell, and
+/// builds the geometry of the tiles by square chunks.
+///
+/// Each chunk keeps its vertices in a static vertex buffer,
+/// so drawing a map doesn't upload anything to the graphics
+/// card as long as its tiles don't change: a chunk is only
+/// rebuilt after one of its cells changed, the next time it
+/// is visible. When drawn, the map skips the chunks that are
+/// outside the current view of the target, so huge maps
+/// cost no more than the part of them that is on screen.
+///
+/// When the map is drawn to a render queue (for example a
+/// sf::RenderCommandBuffer filled on a worker thread), the
+/// chunks record their vertices instead of using the vertex
+/// buffers, so that no OpenGL call is made.
+///
+/// Tiles can be animated: an animated tile displays a list
+/// of other tiles in turn, without the cells that contain
+/// it having to be changed one by one.
+///
+/// Like sf::Sprite, sf::TileMap doesn't own its texture, and
+/// inherits sf::Transformable to be positioned, rotated and
+/// scaled as a whole.
+///
+/// Usage example:
+/// \code
+/// sf::Texture tileset;
+/// if (!tileset.loadFromFile("tileset.png"))
+///     return -1;
+///
+/// // A 4096x4096 map of 16x16 tiles
+/// sf::TileMap map(tileset, {16, 16}, {4096, 4096});
+/// map.setTiles(level.data());
+///
+/// // Water (tile 12) is animated with tiles 12 to 15
+/// map.setAnimation(12, {12, 13, 14, 15}, sf::milliseconds(200));
+///
+/// while (window.isOpen())
+/// {
+///     map.update(clock.restart());
+///
+///     window.clear();
+///     window.draw(map);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::VertexBuffer, sf::Sprite
+///
+////////////////////////////////////////////////////////////
@@ -32,13 +32,18 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
+#include <cassert>
+#include <cstddef>
+
 
 namespace sf
 {
 class Angle;
+class Vertex;
 
 ////////////////////////////////////////////////////////////
-/// \brief Define a 3x3 transform matrix
+/// \brief Define a 2D affine transform matrix
 ///
 ////////////////////////////////////////////////////////////
 class Transform
@@ -55,15 +60,20 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Construct a transform from a 3x3 matrix
     ///
+    /// Transforms are affine: only the first two rows are
+    /// stored, the last row must be (0, 0, 1). Projective
+    /// matrices are not supported, passing another last row
+    /// triggers an assertion in debug builds.
+    ///
     /// \param a00 Element (0, 0) of the matrix
     /// \param a01 Element (0, 1) of the matrix
     /// \param a02 Element (0, 2) of the matrix
     /// \param a10 Element (1, 0) of the matrix
     /// \param a11 Element (1, 1) of the matrix
     /// \param a12 Element (1, 2) of the matrix
-    /// \param a20 Element (2, 0) of the matrix
-    /// \param a21 Element (2, 1) of the matrix
-    /// \param a22 Element (2, 2) of the matrix
+    /// \param a20 Element (2, 0) of the matrix, must be 0
+    /// \param a21 Element (2, 1) of the matrix, must be 0
+    /// \param a22 Element (2, 2) of the matrix, must be 1
     ///
     ////////////////////////////////////////////////////////////
     constexpr Transform(float a00, float a01, float a02, float a10, float a11, float a12, float a20, float a21, float a22);
@@ -71,19 +81,20 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Return the transform as a 4x4 matrix
     ///
-    /// This function returns a pointer to an array of 16 floats
-    /// containing the transform elements as a 4x4 matrix, which
-    /// is directly compatible with OpenGL functions.
+    /// This function returns an array of 16 floats containing
+    /// the transform elements as a 4x4 matrix, which is directly
+    /// compatible with OpenGL functions. The matrix is expanded
+    /// from the compact representation at each call.
     ///
     /// \code
     /// sf::Transform transform = ...;
-    /// glLoadMatrixf(transform.getMatrix());
+    /// glLoadMatrixf(transform.getMatrix().data());
     /// \endcode
     ///
-    /// \return Pointer to a 4x4 matrix
+    /// \return 4x4 matrix, in column-major order
     ///
     ////////////////////////////////////////////////////////////
-    constexpr const float* getMatrix() const;
+    constexpr std::array<float, 16> getMatrix() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the inverse of the transform
@@ -112,6 +123,39 @@ public:
     ////////////////////////////////////////////////////////////
     constexpr Vector2f transformPoint(const Vector2f& point) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// The result is the same as calling transformPoint on each
+    /// point, but large arrays are transformed much faster: the
+    /// points are processed by pairs with SIMD instructions
+    /// when the CPU supports them (SSE2 or NEON).
+    ///
+    /// \a result can be the same array as \a points.
+    ///
+    /// \param points Points to transform
+    /// \param count  Number of points
+    /// \param result Array receiving the transformed points, must have room for \a count elements
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(const Vector2f* points, std::size_t count, Vector2f* result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices
+    ///
+    /// The positions are transformed like with the overload
+    /// taking points, the colors and texture coordinates are
+    /// copied unchanged.
+    ///
+    /// \a result can be the same array as \a vertices.
+    ///
+    /// \param vertices Vertices to transform
+    /// \param count    Number of vertices
+    /// \param result   Array receiving the transformed vertices, must have room for \a count elements
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(const Vertex* vertices, std::size_t count, Vertex* result) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
     ///
@@ -262,15 +306,15 @@ public:
     static const Transform Identity; //!< The identity transform (does nothing)
 
 private:
+    friend constexpr bool operator==(const Transform& left, const Transform& right);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     // clang-format off
-    float m_matrix[16]{1.f, 0.f, 0.f, 0.f,
-                       0.f, 1.f, 0.f, 0.f,
-                       0.f, 0.f, 1.f, 0.f,
-                       0.f, 0.f, 0.f, 1.f}; //!< 4x4 matrix defining the transformation
-    // clang-format off
+    float m_matrix[6]{1.f, 0.f, 0.f,
+                      0.f, 1.f, 0.f}; //!< First two rows of the 3x3 matrix, the last one is always (0, 0, 1)
+    // clang-format on
 };
 
 ////////////////////////////////////////////////////////////
@@ -354,8 +398,12 @@ constexpr Vector2f operator*(const Transform& left, const Vector2f& right);
 /// \ingroup graphics
 ///
 /// A sf::Transform specifies how to translate, rotate, scale,
-/// shear, project, whatever things. In mathematical terms, it defines
-/// how to transform a coordinate system into another.
+/// shear, whatever things. In mathematical terms, it defines
+/// how to transform a coordinate system into another. Transforms
+/// are affine (parallel lines stay parallel): they are stored as
+/// a 2x3 matrix, and expanded to a 4x4 matrix only when they are
+/// sent to OpenGL. Perspective transforms, whose 3x3 matrix has
+/// a last row other than (0, 0, 1), can't be represented.
 ///
 /// For example, if you apply a rotation transform to a sprite, the
 /// result will be a rotated sprite. And anything that is transformed
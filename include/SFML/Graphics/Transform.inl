@@ -32,46 +32,50 @@ constexpr Transform::Transform() = default;
 constexpr Transform::Transform(float a00, float a01, float a02,
                                float a10, float a11, float a12,
                                float a20, float a21, float a22)
-    : m_matrix{a00, a10, 0.f, a20,
-               a01, a11, 0.f, a21,
-               0.f, 0.f, 1.f, 0.f,
-               a02, a12, 0.f, a22}
+    : m_matrix{a00, a01, a02,
+               a10, a11, a12}
 {
+    assert(a20 == 0.f && a21 == 0.f && a22 == 1.f && "sf::Transform only supports affine matrices");
 }
 // clang-format on
 
 
 ////////////////////////////////////////////////////////////
-constexpr const float* Transform::getMatrix() const
+constexpr std::array<float, 16> Transform::getMatrix() const
 {
-    return m_matrix;
+    const float* a = m_matrix;
+
+    // clang-format off
+    return {a[0], a[3], 0.f, 0.f,
+            a[1], a[4], 0.f, 0.f,
+            0.f,  0.f,  1.f, 0.f,
+            a[2], a[5], 0.f, 1.f};
+    // clang-format on
 }
 
 
 ////////////////////////////////////////////////////////////
 constexpr Transform Transform::getInverse() const
 {
-    // clang-format off
+    const float* a = m_matrix;
+
     // Compute the determinant
-    float det = m_matrix[0] * (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13]) -
-                m_matrix[1] * (m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12]) +
-                m_matrix[3] * (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]);
-    // clang-format on
+    const float det = a[0] * a[4] - a[1] * a[3];
 
     // Compute the inverse if the determinant is not zero
     // (don't use an epsilon because the determinant may *really* be tiny)
     if (det != 0.f)
     {
         // clang-format off
-        return Transform( (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13]) / det,
-                         -(m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12]) / det,
-                          (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]) / det,
-                         -(m_matrix[15] * m_matrix[1] - m_matrix[3] * m_matrix[13]) / det,
-                          (m_matrix[15] * m_matrix[0] - m_matrix[3] * m_matrix[12]) / det,
-                         -(m_matrix[13] * m_matrix[0] - m_matrix[1] * m_matrix[12]) / det,
-                          (m_matrix[7]  * m_matrix[1] - m_matrix[3] * m_matrix[5])  / det,
-                         -(m_matrix[7]  * m_matrix[0] - m_matrix[3] * m_matrix[4])  / det,
-                          (m_matrix[5]  * m_matrix[0] - m_matrix[1] * m_matrix[4])  / det);
+        return Transform( a[4] / det,
+                         -a[1] / det,
+                          (a[1] * a[5] - a[4] * a[2]) / det,
+                         -a[3] / det,
+                          a[0] / det,
+                          (a[3] * a[2] - a[0] * a[5]) / det,
+                          0.f,
+                          0.f,
+                          1.f);
         // clang-format on
     }
     else
@@ -84,8 +88,8 @@ constexpr Transform Transform::getInverse() const
 ////////////////////////////////////////////////////////////
 constexpr Vector2f Transform::transformPoint(const Vector2f& point) const
 {
-    return Vector2f(m_matrix[0] * point.x + m_matrix[4] * point.y + m_matrix[12],
-                    m_matrix[1] * point.x + m_matrix[5] * point.y + m_matrix[13]);
+    return Vector2f(m_matrix[0] * point.x + m_matrix[1] * point.y + m_matrix[2],
+                    m_matrix[3] * point.x + m_matrix[4] * point.y + m_matrix[5]);
 }
 
 
@@ -125,16 +129,15 @@ constexpr Transform& Transform::combine(const Transform& transform)
     const float* a = m_matrix;
     const float* b = transform.m_matrix;
 
+    // The last rows are (0, 0, 1), they don't need to be multiplied
     // clang-format off
-    *this = Transform(a[0] * b[0]  + a[4] * b[1]  + a[12] * b[3],
-                      a[0] * b[4]  + a[4] * b[5]  + a[12] * b[7],
-                      a[0] * b[12] + a[4] * b[13] + a[12] * b[15],
-                      a[1] * b[0]  + a[5] * b[1]  + a[13] * b[3],
-                      a[1] * b[4]  + a[5] * b[5]  + a[13] * b[7],
-                      a[1] * b[12] + a[5] * b[13] + a[13] * b[15],
-                      a[3] * b[0]  + a[7] * b[1]  + a[15] * b[3],
-                      a[3] * b[4]  + a[7] * b[5]  + a[15] * b[7],
-                      a[3] * b[12] + a[7] * b[13] + a[15] * b[15]);
+    *this = Transform(a[0] * b[0] + a[1] * b[3],
+                      a[0] * b[1] + a[1] * b[4],
+                      a[0] * b[2] + a[1] * b[5] + a[2],
+                      a[3] * b[0] + a[4] * b[3],
+                      a[3] * b[1] + a[4] * b[4],
+                      a[3] * b[2] + a[4] * b[5] + a[5],
+                      0.f,          0.f,          1.f);
     // clang-format on
 
     return *this;
@@ -204,13 +207,12 @@ constexpr Vector2f operator*(const Transform& left, const Vector2f& right)
 ////////////////////////////////////////////////////////////
 constexpr bool operator==(const Transform& left, const Transform& right)
 {
-    const float* a = left.getMatrix();
-    const float* b = right.getMatrix();
+    const float* a = left.m_matrix;
+    const float* b = right.m_matrix;
 
     // clang-format off
-    return ((a[0]  == b[0])  && (a[1]  == b[1])  && (a[3]  == b[3]) &&
-            (a[4]  == b[4])  && (a[5]  == b[5])  && (a[7]  == b[7]) &&
-            (a[12] == b[12]) && (a[13] == b[13]) && (a[15] == b[15]));
+    return ((a[0] == b[0]) && (a[1] == b[1]) && (a[2] == b[2]) &&
+            (a[3] == b[3]) && (a[4] == b[4]) && (a[5] == b[5]));
     // clang-format on
 }
 
@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+class Color;
+class Transform;
+class Vertex;
+
+////////////////////////////////////////////////////////////
+/// \brief Position, rotation, scale and origin of many objects,
+///        stored as a structure of arrays
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TransformableArray
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty array.
+    ///
+    ////////////////////////////////////////////////////////////
+    TransformableArray();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the array with a given number of objects
+    ///
+    /// \param count Number of objects
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TransformableArray(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the number of objects
+    ///
+    /// If \a count is greater than the current size, the new
+    /// objects get the default values of sf::Transformable:
+    /// position (0, 0), rotation 0, scale (1, 1) and origin (0, 0).
+    /// If \a count is less than the current size, the last
+    /// objects are removed.
+    ///
+    /// \param count New number of objects
+    ///
+    /// \see getSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void resize(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of objects
+    ///
+    /// \return Number of objects
+    ///
+    /// \see resize
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an object at the end of the array
+    ///
+    /// \param position Position of the object
+    /// \param rotation Orientation of the object
+    /// \param scale    Scale factors of the object
+    /// \param origin   Origin of translation/rotation/scaling of the object
+    ///
+    /// \return Index of the new object
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Vector2f& position,
+                    Angle           rotation = Angle::Zero,
+                    const Vector2f& scale    = Vector2f(1, 1),
+                    const Vector2f& origin   = Vector2f(0, 0));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an object by replacing it with the last one
+    ///
+    /// This is done in constant time, but it changes the index
+    /// of the last object, which takes the place of the removed
+    /// one. The behavior is undefined if \a index is out of range.
+    ///
+    /// \param index Index of the object to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void swapRemove(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the positions of the objects
+    ///
+    /// The array contains getSize() elements; it is invalidated
+    /// when the number of objects changes.
+    ///
+    /// \return Pointer to the positions
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f* getPositions();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get read-only access to the positions of the objects
+    ///
+    /// \return Pointer to the positions
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f* getPositions() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the orientations of the objects
+    ///
+    /// The array contains getSize() elements; it is invalidated
+    /// when the number of objects changes. Unlike
+    /// sf::Transformable::setRotation, angles written to it are
+    /// used as is, they are not wrapped to [0, 360) degrees.
+    ///
+    /// \return Pointer to the orientations
+    ///
+    ////////////////////////////////////////////////////////////
+    Angle* getRotations();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get read-only access to the orientations of the objects
+    ///
+    /// \return Pointer to the orientations
+    ///
+    ////////////////////////////////////////////////////////////
+    const Angle* getRotations() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of the objects
+    ///
+    /// The array contains getSize() elements; it is invalidated
+    /// when the number of objects changes.
+    ///
+    /// \return Pointer to the scale factors
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f* getScales();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get read-only access to the scale factors of the objects
+    ///
+    /// \return Pointer to the scale factors
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f* getScales() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the origins of the objects
+    ///
+    /// The array contains getSize() elements; it is invalidated
+    /// when the number of objects changes.
+    ///
+    /// \return Pointer to the origins
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f* getOrigins();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get read-only access to the origins of the objects
+    ///
+    /// \return Pointer to the origins
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f* getOrigins() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the combined transforms of a range of objects
+    ///
+    /// The transforms are the same as the ones returned by
+    /// sf::Transformable::getTransform for the same attributes.
+    /// This function doesn't modify the array, so disjoint
+    /// ranges can be computed in parallel from several threads.
+    ///
+    /// \param first      Index of the first object
+    /// \param count      Number of objects
+    /// \param transforms Array receiving the transforms, must have room for \a count elements
+    ///
+    ////////////////////////////////////////////////////////////
+    void computeTransforms(std::size_t first, std::size_t count, Transform* transforms) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the vertices of textured quads for a range of objects
+    ///
+    /// Each object is drawn like a sf::Sprite with the same
+    /// transform: a quad the size of its texture rectangle,
+    /// whose top-left corner is at the object's local (0, 0).
+    /// Each quad is written as 4 vertices, in the same order as
+    /// sf::TileMap and sf::ParticleSystem: the vertices of the
+    /// object i start at vertices + i * 4. The result is drawn in
+    /// a single call with the sf::PrimitiveType::Triangles
+    /// primitive type and the shared quad indices, which are
+    /// 4i, 4i+1, 4i+2, 4i+2, 4i+1, 4i+3 for the quad i.
+    ///
+    /// The transforms are never stored: they are computed and
+    /// applied on the fly. Like computeTransforms, this function
+    /// can be called in parallel for disjoint ranges.
+    ///
+    /// \param first        Index of the first object
+    /// \param count        Number of objects
+    /// \param textureRects Texture rectangle of each object of the range
+    /// \param colors       Color of each object of the range, or a null pointer for opaque white
+    /// \param vertices     Array receiving the vertices, must have room for 4 * \a count elements
+    ///
+    ////////////////////////////////////////////////////////////
+    void computeQuads(std::size_t    first,
+                      std::size_t    count,
+                      const IntRect* textureRects,
+                      const Color*   colors,
+                      Vertex*        vertices) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f> m_positions; //!< Position of each object in the 2D world
+    std::vector<Angle>    m_rotations; //!< Orientation of each object
+    std::vector<Vector2f> m_scales;    //!< Scale of each object
+    std::vector<Vector2f> m_origins;   //!< Origin of translation/rotation/scaling of each object
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TransformableArray
+/// \ingroup graphics
+///
+/// sf::TransformableArray holds the same attributes as
+/// sf::Transformable (position, rotation, scale, origin),
+/// for many objects at once. Each attribute is stored in its
+/// own contiguous array, so that code which updates one of
+/// them for all the objects (moving units, spinning
+/// particles...) only touches the memory it needs.
+///
+/// Instead of computing and caching a transform per object,
+/// transforms are computed in bulk, on demand: computeTransforms
+/// writes them to an array, and computeQuads directly produces
+/// the 4 vertices of sprite-like quads, ready to be drawn with
+/// a single indexed draw call (or uploaded to a sf::VertexBuffer).
+///
+/// Usage example:
+/// \code
+/// sf::TransformableArray units;
+/// for (const Unit& unit : level.units)
+///     units.add(unit.position, unit.heading, {1, 1}, {16, 16});
+///
+/// std::vector<sf::IntRect>   frames(units.getSize(), sf::IntRect({0, 0}, {32, 32}));
+/// std::vector<sf::Vertex>    vertices(units.getSize() * 4);
+/// std::vector<std::uint32_t> indices;
+/// for (std::uint32_t base = 0; base < vertices.size(); base += 4)
+///     indices.insert(indices.end(), {base, base + 1, base + 2, base + 2, base + 1, base + 3});
+///
+/// // Each frame
+/// for (std::size_t i = 0; i < units.getSize(); ++i)
+///     units.getPositions()[i] += velocities[i] * dt;
+///
+/// units.computeQuads(0, units.getSize(), frames.data(), nullptr, vertices.data());
+///
+/// sf::RenderStates states(&texture);
+/// window.draw(vertices.data(),
+///             vertices.size(),
+///             indices.data(),
+///             indices.size(),
+///             sf::PrimitiveType::Triangles,
+///             states);
+/// \endcode
+///
+/// \see sf::Transformable, sf::Sprite
+///
+////////////////////////////////////////////////////////////
@@ -29,17 +29,115 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Export.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <iosfwd>
+#include <string>
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief Standard stream used by SFML to output warnings and errors
+/// \brief Delivery of the messages written to sf::err
+///
+////////////////////////////////////////////////////////////
+namespace Log
+{
+////////////////////////////////////////////////////////////
+/// \brief Severity of a message
+///
+////////////////////////////////////////////////////////////
+enum class Level
+{
+    Info,    //!< Information that doesn't require any action
+    Warning, //!< Something unexpected happened, but SFML could work around it
+    Error    //!< An operation failed
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Message written to sf::err
+///
+////////////////////////////////////////////////////////////
+struct Record
+{
+    Level                                 level{};  //!< Severity of the message
+    std::string                           message;  //!< Text of the message, without the trailing newline
+    std::chrono::system_clock::time_point time{};   //!< Time at which the message was first written
+    std::size_t                           count{1}; //!< Number of identical messages this record stands for
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Function receiving the messages
+///
+////////////////////////////////////////////////////////////
+using Sink = std::function<void(const Record&)>;
+
+////////////////////////////////////////////////////////////
+/// \brief Change the function receiving the messages
+///
+/// The sink is called from a background thread, never from
+/// the thread that wrote the message, and never concurrently.
+/// Passing an empty function disables sf::err: writing to it
+/// then costs almost nothing.
+///
+/// By default, messages are written to the standard error
+/// output by writeToStandardError.
+///
+/// \param sink New sink, or an empty function to discard the messages
+///
+/// \see flush, writeToStandardError
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void setSink(Sink sink);
+
+////////////////////////////////////////////////////////////
+/// \brief Default sink, writes a message to the standard error output
+///
+/// Repeated messages are followed by their number of repetitions.
+///
+/// \param record Message to write
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void writeToStandardError(const Record& record);
+
+////////////////////////////////////////////////////////////
+/// \brief Change the minimum severity of the messages delivered to the sink
+///
+/// Messages of a lower severity are discarded when they are
+/// written, at almost no cost. The default is Level::Info.
+///
+/// \param level Minimum severity of the delivered messages
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void setMinimumLevel(Level level);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until all the pending messages are delivered to the sink
+///
+/// Repeated messages waiting for deduplication are delivered
+/// too. This function must not be called from the sink.
+///
+/// \see setSink
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void flush();
+} // namespace Log
+
+////////////////////////////////////////////////////////////
+/// \brief Standard stream used by SFML to output errors
 ///
 ////////////////////////////////////////////////////////////
 SFML_SYSTEM_API std::ostream& err();
 
+////////////////////////////////////////////////////////////
+/// \brief Standard stream used by SFML to output messages of a given severity
+///
+/// \param level Severity of the messages written to the stream
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API std::ostream& err(Log::Level level);
+
 } // namespace sf
 
 
@@ -55,9 +153,22 @@ SFML_SYSTEM_API std::ostream& err();
 /// insertion operations defined by the STL
 /// (operator <<, manipulators, etc.).
 ///
+/// Each line written to sf::err() becomes a message (an
+/// sf::Log::Record), which is queued and delivered to the log
+/// sink by a background thread, so writing to sf::err() never
+/// waits for the output. Lines are buffered per thread, so
+/// messages written by different threads are not mixed.
+///
+/// A message identical to the previous one, written less than
+/// a second after it was delivered, is not delivered again:
+/// it is counted, and a single record with the number of
+/// repetitions is delivered at the end of the second. At most
+/// 1024 messages wait in the queue, further ones are dropped
+/// and reported by a warning once there is room again.
+///
 /// sf::err() can be redirected to write to another output, independently
 /// of std::cerr, by using the rdbuf() function provided by the
-/// std::ostream class.
+/// std::ostream class. A redirected stream bypasses the log sink.
 ///
 /// Example:
 /// \code
@@ -70,6 +181,16 @@ SFML_SYSTEM_API std::ostream& err();
 ///
 /// // Restore the original output
 /// sf::err().rdbuf(previous);
+///
+/// // Receive the messages in a custom logger
+/// sf::Log::setSink([](const sf::Log::Record& record)
+///                  { myLogger.write(record.level, record.message, record.count); });
+///
+/// // Only keep the errors
+/// sf::Log::setMinimumLevel(sf::Log::Level::Error);
+///
+/// // Disable sf::err entirely
+/// sf::Log::setSink({});
 /// \endcode
 ///
 /// \return Reference to std::ostream representing the SFML error stream
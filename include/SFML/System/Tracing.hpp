@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Access to the timings recorded inside SFML
+///
+////////////////////////////////////////////////////////////
+namespace Tracing
+{
+////////////////////////////////////////////////////////////
+/// \brief Zone of code executed by SFML
+///
+////////////////////////////////////////////////////////////
+struct Event
+{
+    const char*              name{};     //!< Name of the zone, usually the name of the function
+    std::uint64_t            thread{};   //!< Identifier of the thread which executed the zone, the first one is 1
+    std::chrono::nanoseconds start{};    //!< Start of the zone on the std::chrono::steady_clock timeline
+    std::chrono::nanoseconds duration{}; //!< Time spent in the zone
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether tracing was enabled when SFML was built
+///
+/// Tracing is enabled with the SFML_ENABLE_TRACING CMake
+/// option. When disabled, no event is ever recorded.
+///
+/// \return True if SFML records trace events
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API bool isEnabled();
+
+////////////////////////////////////////////////////////////
+/// \brief Pass the pending events to a callback
+///
+/// The events recorded by all the threads since the previous
+/// flush are removed from their buffers and given to \a callback,
+/// ordered by thread then by end time. The callback must not
+/// flush again.
+///
+/// \param callback Function to call for each event
+///
+/// \see flushToFile
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void flush(const std::function<void(const Event&)>& callback);
+
+////////////////////////////////////////////////////////////
+/// \brief Write the pending events to a file in the Chrome trace event format
+///
+/// The file is overwritten. It can be loaded in chrome://tracing
+/// or in Perfetto.
+///
+/// \param filename Path of the file to write
+///
+/// \return True if saving was successful
+///
+/// \see flush
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API bool flushToFile(const std::filesystem::path& filename);
+} // namespace Tracing
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::Tracing
+/// \ingroup system
+///
+/// When SFML is built with the SFML_ENABLE_TRACING CMake option,
+/// its hot paths (glyph loading, image decoding, audio streaming,
+/// socket reception, event polling, ...) record the time spent
+/// in them. Each thread records its events in its own lock-free
+/// ring buffer, which costs a few nanoseconds per zone; the
+/// events are collected with sf::Tracing::flush or
+/// sf::Tracing::flushToFile. Events are dropped when a thread
+/// records more than 16384 of them between two flushes.
+///
+/// Without the option, the instrumentation compiles to nothing.
+///
+/// Usage example:
+/// \code
+/// while (window.isOpen())
+/// {
+///     ...
+///
+///     sf::Tracing::flush([](const sf::Tracing::Event& event)
+///     {
+///         if (event.duration > std::chrono::milliseconds(1))
+///             std::cout << event.name << " took " << event.duration.count() << " ns" << std::endl;
+///     });
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -190,6 +190,13 @@ private:
 /// will take care of deactivating and freeing all the attached
 /// resources.
 ///
+/// On Linux with desktop OpenGL, contexts don't need a display
+/// server: when the DISPLAY environment variable is empty, or
+/// when SFML_HEADLESS is set to a value other than 0, they are
+/// created offscreen through EGL without opening any X11
+/// connection. sf::Context and sf::RenderTexture then work on
+/// servers and CI machines; windows can't be shown in that mode.
+///
 /// Usage example:
 /// \code
 /// void threadFunction(void*)
@@ -247,7 +247,13 @@ void InputSoundFile::seek(std::uint64_t sampleOffset)
     {
         // The reader handles an overrun gracefully, but we
         // pre-check to keep our known position consistent
-        m_sampleOffset = std::min(sampleOffset / m_channelCount * m_channelCount, m_sampleCount);
+        sampleOffset = std::min(sampleOffset / m_channelCount * m_channelCount, m_sampleCount);
+
+        // Seeking can be expensive with compressed formats, skip it if we're already there
+        if (sampleOffset == m_sampleOffset)
+            return;
+
+        m_sampleOffset = sampleOffset;
         m_reader->seek(m_sampleOffset);
     }
 }
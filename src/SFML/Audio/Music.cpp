@@ -29,6 +29,7 @@
 #include <SFML/Audio/Music.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Trace.hpp>
 
 #include <algorithm>
 #include <fstream>
@@ -42,7 +43,7 @@
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-Music::Music() : m_file(), m_loopSpan(0, 0)
+Music::Music() : m_file(), m_loopSpan(0, 0), m_playLoopHead(false), m_skipLoopHead(false)
 {
 }
 
@@ -157,7 +158,22 @@ void Music::setLoopPoints(TimeSpan timePoints)
     if (samplePoints.offset == m_loopSpan.offset && samplePoints.length == m_loopSpan.length)
         return;
 
-    // When we apply this change, we need to "reset" this instance and its buffer
+    // If the stream hasn't read past the new loop end yet, none of the queued audio is affected
+    // and the new loop points can be applied without restarting the stream
+    if (getStatus() != Stopped)
+    {
+        std::scoped_lock lock(m_mutex);
+        syncLoopHead();
+
+        if (m_file.getSampleOffset() <= samplePoints.offset + samplePoints.length)
+        {
+            m_loopSpan = samplePoints;
+            m_loopHead.clear();
+            return;
+        }
+    }
+
+    // Otherwise, we need to "reset" this instance and its buffer
 
     // Get old playing status and position
     Status oldStatus = getStatus();
@@ -167,7 +183,11 @@ void Music::setLoopPoints(TimeSpan timePoints)
     stop();
 
     // Set
-    m_loopSpan = samplePoints;
+    {
+        std::scoped_lock lock(m_mutex);
+        m_loopSpan = samplePoints;
+        m_loopHead.clear();
+    }
 
     // Restore
     if (oldPos != Time::Zero)
@@ -182,12 +202,36 @@ void Music::setLoopPoints(TimeSpan timePoints)
 ////////////////////////////////////////////////////////////
 bool Music::onGetData(SoundStream::Chunk& data)
 {
+    SFML_TRACE_ZONE("Music::onGetData");
+
     std::scoped_lock lock(m_mutex);
 
+    if (m_playLoopHead)
+    {
+        // We just looped: serve the beginning of the loop from memory, the file will
+        // seek past it on the next call, when the stream has buffered audio to play
+        m_playLoopHead   = false;
+        m_skipLoopHead   = true;
+        data.samples     = m_loopHead.data();
+        data.sampleCount = m_loopHead.size();
+
+        // If the loop is shorter than the loop head, we're already at its end
+        return m_loopHead.size() < m_loopSpan.length;
+    }
+
+    syncLoopHead();
+
     std::size_t   toFill        = m_samples.size();
     std::uint64_t currentOffset = m_file.getSampleOffset();
     std::uint64_t loopEnd       = m_loopSpan.offset + m_loopSpan.length;
 
+    // The loop head must be ready before the stream reaches the loop end. If the beginning of the loop has
+    // already been read past, decode it now: this costs two seeks, but away from the loop seam
+    const std::size_t loopHeadSize = static_cast<std::size_t>(std::min<std::uint64_t>(toFill, m_loopSpan.length));
+    if (getLoop() && (m_loopSpan.length != 0) && (m_loopHead.size() < loopHeadSize) &&
+        (currentOffset > m_loopSpan.offset + m_loopHead.size()) && (currentOffset <= loopEnd))
+        decodeLoopHead();
+
     // If the loop end is enabled and imminent, request less data.
     // This will trip an "onLoop()" call from the underlying SoundStream,
     // and we can then take action.
@@ -197,6 +241,19 @@ bool Music::onGetData(SoundStream::Chunk& data)
     // Fill the chunk parameters
     data.samples     = m_samples.data();
     data.sampleCount = static_cast<std::size_t>(m_file.read(m_samples.data(), toFill));
+
+    // When reading through the beginning of the loop, keep its samples as the loop head
+    // so that it doesn't have to be decoded separately
+    const std::uint64_t loopHeadEnd = m_loopSpan.offset + m_loopHead.size();
+    if ((m_loopHead.size() < loopHeadSize) && (currentOffset <= loopHeadEnd) &&
+        (loopHeadEnd < currentOffset + data.sampleCount))
+    {
+        const std::int16_t* first = m_samples.data() + (loopHeadEnd - currentOffset);
+        const std::size_t   count = std::min(loopHeadSize - m_loopHead.size(),
+                                           static_cast<std::size_t>(currentOffset + data.sampleCount - loopHeadEnd));
+        m_loopHead.insert(m_loopHead.end(), first, first + count);
+    }
+
     currentOffset += data.sampleCount;
 
     // Check if we have stopped obtaining samples or reached either the EOF or the loop end point
@@ -209,6 +266,8 @@ bool Music::onGetData(SoundStream::Chunk& data)
 void Music::onSeek(Time timeOffset)
 {
     std::scoped_lock lock(m_mutex);
+    m_playLoopHead = false;
+    m_skipLoopHead = false;
     m_file.seek(timeOffset);
 }
 
@@ -223,6 +282,13 @@ std::int64_t Music::onLoop()
     {
         // Looping is enabled, and either we're at the loop end, or we're at the EOF
         // when it's equivalent to the loop end (loop end takes priority). Send us to loop begin
+        if (!m_loopHead.empty())
+        {
+            // Play the pre-decoded loop head first, the file is left at the loop end until then
+            m_playLoopHead = true;
+            return static_cast<std::int64_t>(m_loopSpan.offset);
+        }
+
         m_file.seek(m_loopSpan.offset);
         return static_cast<std::int64_t>(m_file.getSampleOffset());
     }
@@ -246,10 +312,49 @@ void Music::initialize()
     // Resize the internal buffer so that it can contain 1 second of audio samples
     m_samples.resize(static_cast<std::size_t>(m_file.getSampleRate()) * static_cast<std::size_t>(m_file.getChannelCount()));
 
+    // The beginning of the loop is kept when it is first read, for seamless looping
+    m_loopHead.clear();
+    m_playLoopHead = false;
+    m_skipLoopHead = false;
+
     // Initialize the stream
     SoundStream::initialize(m_file.getChannelCount(), m_file.getSampleRate());
 }
 
+
+////////////////////////////////////////////////////////////
+void Music::decodeLoopHead()
+{
+    std::scoped_lock lock(m_mutex);
+
+    // A loop head of one buffer is enough to hide the seek
+    const std::uint64_t offset = m_file.getSampleOffset();
+    m_loopHead.resize(static_cast<std::size_t>(std::min<std::uint64_t>(m_samples.size(), m_loopSpan.length)));
+
+    m_file.seek(m_loopSpan.offset);
+    m_loopHead.resize(static_cast<std::size_t>(m_file.read(m_loopHead.data(), m_loopHead.size())));
+    m_file.seek(offset);
+
+    m_playLoopHead = false;
+    m_skipLoopHead = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void Music::syncLoopHead()
+{
+    std::scoped_lock lock(m_mutex);
+
+    if (m_playLoopHead)
+        m_file.seek(m_loopSpan.offset);
+    else if (m_skipLoopHead)
+        m_file.seek(m_loopSpan.offset + m_loopHead.size());
+
+    m_playLoopHead = false;
+    m_skipLoopHead = false;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::uint64_t Music::timeToSamples(Time position) const
 {
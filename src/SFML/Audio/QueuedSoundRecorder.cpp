@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/QueuedSoundRecorder.hpp>
+
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+QueuedSoundRecorder::QueuedSoundRecorder(Time capacity) :
+m_capacity(capacity),
+m_writeCount(0),
+m_readCount(0),
+m_dropCount(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+QueuedSoundRecorder::~QueuedSoundRecorder()
+{
+    // Make sure to stop the recording thread
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t QueuedSoundRecorder::read(std::int16_t* samples, std::size_t maxCount)
+{
+    if (m_queue.empty())
+        return 0;
+
+    // The acquire load makes the samples written before the count visible to this thread
+    const std::uint64_t readCount  = m_readCount.load(std::memory_order_relaxed);
+    const std::uint64_t writeCount = m_writeCount.load(std::memory_order_acquire);
+
+    // Only read whole frames
+    maxCount -= maxCount % getChannelCount();
+    const std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(maxCount, writeCount - readCount));
+
+    // Copy the samples, in two parts if they wrap around the end of the ring buffer
+    const std::size_t start = static_cast<std::size_t>(readCount % m_queue.size());
+    const std::size_t first = std::min(count, m_queue.size() - start);
+    std::copy_n(m_queue.data() + start, first, samples);
+    std::copy_n(m_queue.data(), count - first, samples + first);
+
+    // Give the space back to the capture thread once the samples are copied
+    m_readCount.store(readCount + count, std::memory_order_release);
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t QueuedSoundRecorder::getDroppedSampleCount() const
+{
+    return m_dropCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool QueuedSoundRecorder::onStart()
+{
+    // Allocate the ring buffer once for the whole capture, as a whole number of frames
+    const auto frames = static_cast<std::size_t>(m_capacity.asMicroseconds() * getSampleRate() / 1000000);
+    m_queue.assign(std::max<std::size_t>(frames, 1) * getChannelCount(), 0);
+
+    m_writeCount = 0;
+    m_readCount  = 0;
+    m_dropCount  = 0;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool QueuedSoundRecorder::onProcessSamples(const std::int16_t* samples, std::size_t sampleCount)
+{
+    // The acquire load makes sure that the consumer is done with the space it gave back
+    const std::uint64_t writeCount = m_writeCount.load(std::memory_order_relaxed);
+    const std::uint64_t readCount  = m_readCount.load(std::memory_order_acquire);
+
+    // Queue as many samples as there is room for, and drop the rest
+    const auto        freeCount = static_cast<std::size_t>(m_queue.size() - (writeCount - readCount));
+    const std::size_t count     = std::min(sampleCount, freeCount);
+    m_dropCount.fetch_add(sampleCount - count, std::memory_order_relaxed);
+
+    // Copy the samples, in two parts if they wrap around the end of the ring buffer
+    const std::size_t start = static_cast<std::size_t>(writeCount % m_queue.size());
+    const std::size_t first = std::min(count, m_queue.size() - start);
+    std::copy_n(samples, first, m_queue.data() + start);
+    std::copy_n(samples + first, count - first, m_queue.data());
+
+    // Publish the samples to the consumer thread
+    m_writeCount.store(writeCount + count, std::memory_order_release);
+
+    return true;
+}
+
+} // namespace sf
@@ -44,7 +44,7 @@
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-SoundBuffer::SoundBuffer() : m_buffer(0), m_duration()
+SoundBuffer::SoundBuffer() : m_buffer(0), m_sampleCount(0), m_duration()
 {
     // Create the buffer
     alCheck(alGenBuffers(1, &m_buffer));
@@ -55,6 +55,7 @@ SoundBuffer::SoundBuffer() : m_buffer(0), m_duration()
 SoundBuffer::SoundBuffer(const SoundBuffer& copy) :
 m_buffer(0),
 m_samples(copy.m_samples),
+m_sampleCount(0),
 m_duration(copy.m_duration),
 m_sounds() // don't copy the attached sounds
 {
@@ -150,6 +151,12 @@ bool SoundBuffer::loadFromSamples(const std::int16_t* samples,
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 {
+    if (m_samples.empty())
+    {
+        err() << "Failed to save sound buffer to file (no samples, they may have been released)" << std::endl;
+        return false;
+    }
+
     // Create the sound file in write mode
     OutputSoundFile file;
     if (file.openFromFile(filename, getSampleRate(), getChannelCount()))
@@ -176,7 +183,16 @@ const std::int16_t* SoundBuffer::getSamples() const
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundBuffer::getSampleCount() const
 {
-    return m_samples.size();
+    return m_sampleCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::releaseSamples()
+{
+    // The OpenAL buffer keeps its own copy of the samples
+    m_samples.clear();
+    m_samples.shrink_to_fit();
 }
 
 
@@ -214,6 +230,7 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
 
     std::swap(m_samples, temp.m_samples);
     std::swap(m_buffer, temp.m_buffer);
+    std::swap(m_sampleCount, temp.m_sampleCount);
     std::swap(m_duration, temp.m_duration);
     std::swap(m_sounds, temp.m_sounds); // swap sounds too, so that they are detached when temp is destroyed
 
@@ -270,6 +287,7 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate)
     // Fill the buffer
     auto size = static_cast<ALsizei>(m_samples.size() * sizeof(std::int16_t));
     alCheck(alBufferData(m_buffer, format, m_samples.data(), size, static_cast<ALsizei>(sampleRate)));
+    m_sampleCount = m_samples.size();
 
     // Compute the duration
     m_duration = seconds(
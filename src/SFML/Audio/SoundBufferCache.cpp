@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/SoundBufferCache.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <fstream>
+#include <ostream>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoundBufferCache::SoundBufferCache(std::size_t maxDecodedSize) :
+m_maxDecodedSize(maxDecodedSize),
+m_decodedSize(0),
+m_compressedSize(0),
+m_useCounter(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::SoundBufferCache(SoundBufferCache&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache& SoundBufferCache::operator=(SoundBufferCache&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool SoundBufferCache::loadFromFile(const std::string& name, const std::filesystem::path& filename)
+{
+    std::ifstream file(filename, std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to open sound file for the cache\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Read the whole compressed file in memory
+    file.seekg(0, std::ios_base::end);
+    const std::ifstream::pos_type size = file.tellg();
+    file.seekg(0, std::ios_base::beg);
+
+    std::vector<char> data(size > 0 ? static_cast<std::size_t>(size) : 0);
+    if (!file.read(data.data(), static_cast<std::streamsize>(data.size())))
+    {
+        err() << "Failed to read sound file for the cache\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return loadFromMemory(name, data.data(), data.size());
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBufferCache::loadFromMemory(const std::string& name, const void* data, std::size_t sizeInBytes)
+{
+    // Make sure the data can be decoded, and retrieve the size of the decoded samples
+    InputSoundFile file;
+    if (!file.openFromMemory(data, sizeInBytes))
+        return false;
+
+    const auto decodedSize = static_cast<std::size_t>(file.getSampleCount()) * sizeof(std::int16_t);
+
+    // Replace any previous sound with the same name
+    remove(name);
+
+    Entry& entry = m_entries[name];
+    entry.data.assign(static_cast<const std::byte*>(data), static_cast<const std::byte*>(data) + sizeInBytes);
+    entry.size     = decodedSize;
+    entry.lastUsed = 0;
+
+    m_compressedSize += sizeInBytes;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+const SoundBuffer* SoundBufferCache::get(const std::string& name)
+{
+    auto it = m_entries.find(name);
+    if (it == m_entries.end())
+        return nullptr;
+
+    Entry& entry   = it->second;
+    entry.lastUsed = ++m_useCounter;
+
+    if (!entry.buffer)
+    {
+        // Decode the sound and only keep the copy uploaded to the audio device
+        auto buffer = std::make_unique<SoundBuffer>();
+        if (!buffer->loadFromMemory(entry.data.data(), entry.data.size()))
+        {
+            err() << "Failed to decode sound \"" << name << "\" from the cache" << std::endl;
+            return nullptr;
+        }
+
+        buffer->releaseSamples();
+
+        entry.buffer = std::move(buffer);
+        m_decodedSize += entry.size;
+
+        evict();
+    }
+
+    return entry.buffer.get();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::remove(const std::string& name)
+{
+    auto it = m_entries.find(name);
+    if (it == m_entries.end())
+        return;
+
+    if (it->second.buffer)
+        m_decodedSize -= it->second.size;
+
+    m_compressedSize -= it->second.data.size();
+    m_entries.erase(it);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::setMaxDecodedSize(std::size_t maxDecodedSize)
+{
+    m_maxDecodedSize = maxDecodedSize;
+    evict();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getMaxDecodedSize() const
+{
+    return m_maxDecodedSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getDecodedSize() const
+{
+    return m_decodedSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getCompressedSize() const
+{
+    return m_compressedSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::evict()
+{
+    while (m_decodedSize > m_maxDecodedSize)
+    {
+        // Find the least recently used sound that can be evicted: the most recently
+        // requested one is about to be used, and the ones attached to sounds are in use
+        Entry* leastRecentlyUsed = nullptr;
+        for (auto& [name, entry] : m_entries)
+        {
+            if (!entry.buffer || (entry.lastUsed == m_useCounter) || !entry.buffer->m_sounds.empty())
+                continue;
+
+            if (!leastRecentlyUsed || (entry.lastUsed < leastRecentlyUsed->lastUsed))
+                leastRecentlyUsed = &entry;
+        }
+
+        // Everything left is in use
+        if (!leastRecentlyUsed)
+            break;
+
+        leastRecentlyUsed->buffer.reset();
+        m_decodedSize -= leastRecentlyUsed->size;
+    }
+}
+
+} // namespace sf
@@ -29,6 +29,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <ostream>
@@ -65,6 +66,16 @@ long tell(void* data)
 }
 
 static ov_callbacks callbacks = {&read, &seek, nullptr, &tell};
+
+// Maximum number of seek index points per second of audio; a seek from the index
+// has to decode and drop about this fraction of a second of audio (or one page)
+constexpr ogg_int64_t seekIndexRate = 8;
+
+// A seek from the index never decodes more than this number of seconds of audio
+constexpr ogg_int64_t maxSeekDecodeDuration = 2;
+
+// Number of bytes read at once when scanning the pages of the file
+constexpr long scanChunkSize = 16384;
 } // namespace
 
 namespace sf
@@ -88,7 +99,12 @@ bool SoundFileReaderOgg::check(InputStream& stream)
 
 
 ////////////////////////////////////////////////////////////
-SoundFileReaderOgg::SoundFileReaderOgg() : m_vorbis(), m_channelCount(0)
+SoundFileReaderOgg::SoundFileReaderOgg() :
+m_vorbis(),
+m_channelCount(0),
+m_indexInterval(0),
+m_scanOffset(0),
+m_scanFrame(0)
 {
     m_vorbis.datasource = nullptr;
 }
@@ -121,6 +137,11 @@ bool SoundFileReaderOgg::open(InputStream& stream, Info& info)
     // We must keep the channel count for the seek function
     m_channelCount = info.channelCount;
 
+    // The seek index is built on demand, starting from the first audio page
+    m_indexInterval = std::max<ogg_int64_t>(vorbisInfo->rate / seekIndexRate, 1);
+    m_scanOffset    = m_vorbis.seekable ? m_vorbis.dataoffsets[0] : 0;
+    m_scanFrame     = 0;
+
     return true;
 }
 
@@ -130,7 +151,11 @@ void SoundFileReaderOgg::seek(std::uint64_t sampleOffset)
 {
     assert(m_vorbis.datasource);
 
-    ov_pcm_seek(&m_vorbis, static_cast<ogg_int64_t>(sampleOffset / m_channelCount));
+    const auto frameOffset = static_cast<ogg_int64_t>(sampleOffset / m_channelCount);
+
+    // Jump directly to the right page if possible, otherwise vorbisfile bisects the stream
+    if (!seekFromIndex(frameOffset))
+        ov_pcm_seek(&m_vorbis, frameOffset);
 }
 
 
@@ -170,9 +195,128 @@ void SoundFileReaderOgg::close()
         ov_clear(&m_vorbis);
         m_vorbis.datasource = nullptr;
         m_channelCount      = 0;
+        m_indexInterval     = 0;
+        m_scanOffset        = 0;
+        m_scanFrame         = 0;
+        m_seekIndex.clear();
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderOgg::extendSeekIndex(ogg_int64_t frameOffset)
+{
+    // Only the first logical stream of chained files is indexed, the other ones have their own timeline
+    if (!m_vorbis.seekable || (m_vorbis.links != 1) || (m_scanOffset >= m_vorbis.offsets[1]))
+        return;
+
+    // vorbisfile assumes that the stream stays where it left it, so its position must be restored afterward
+    auto*              stream   = static_cast<InputStream*>(m_vorbis.datasource);
+    const std::int64_t position = stream->tell();
+    if ((position < 0) || (stream->seek(m_scanOffset) != m_scanOffset))
+        return;
+
+    // Read the headers of the pages following the indexed part of the file, without decoding them
+    ogg_sync_state sync;
+    ogg_page       page;
+    ogg_sync_init(&sync);
+
+    while ((m_scanFrame <= frameOffset) && (m_scanOffset < m_vorbis.offsets[1]))
+    {
+        const long result = ogg_sync_pageseek(&sync, &page);
+
+        if (result < 0)
+        {
+            // Garbage between pages was skipped
+            m_scanOffset -= result;
+        }
+        else if (result == 0)
+        {
+            // More data is needed to complete the page
+            char*              buffer = ogg_sync_buffer(&sync, scanChunkSize);
+            const std::int64_t count  = stream->read(buffer, scanChunkSize);
+            if (count <= 0)
+                break;
+
+            ogg_sync_wrote(&sync, static_cast<long>(count));
+        }
+        else
+        {
+            // Pages which don't complete any packet have no granule position
+            const ogg_int64_t granulePosition = ogg_page_granulepos(&page);
+            if ((ogg_page_serialno(&page) == m_vorbis.serialnos[0]) && (granulePosition >= 0))
+            {
+                // The decoding of this page starts where the previous one ended
+                if (m_seekIndex.empty() || (m_scanFrame >= m_seekIndex.back().frameOffset + m_indexInterval))
+                    m_seekIndex.push_back({m_scanFrame, m_scanOffset});
+
+                m_scanFrame = granulePosition - m_vorbis.pcmlengths[0];
+            }
+
+            m_scanOffset += result;
+        }
+    }
+
+    ogg_sync_clear(&sync);
+    stream->seek(position);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileReaderOgg::seekFromIndex(ogg_int64_t frameOffset)
+{
+    // Index the file up to the target if it hasn't been done yet
+    if (m_scanFrame <= frameOffset)
+        extendSeekIndex(frameOffset);
+
+    // Find the last point recorded before the target
+    auto it = std::upper_bound(m_seekIndex.begin(),
+                               m_seekIndex.end(),
+                               frameOffset,
+                               [](ogg_int64_t offset, const SeekPoint& point) { return offset < point.frameOffset; });
+
+    // The decoding of a page may start a bit after the recorded frame,
+    // in which case the previous points are tried
+    const ogg_int64_t maxDistance = m_indexInterval * seekIndexRate * maxSeekDecodeDuration;
+    while (it != m_seekIndex.begin())
+    {
+        --it;
+
+        // The rest has to be decoded, so the point is only useful if it's close enough to the target
+        if (frameOffset - it->frameOffset > maxDistance)
+            return false;
+
+        if (ov_raw_seek(&m_vorbis, it->byteOffset) != 0)
+            return false;
+
+        ogg_int64_t position = ov_pcm_tell(&m_vorbis);
+        if (position < 0)
+            return false;
+
+        if (position > frameOffset)
+            continue;
+
+        // Decode and drop the frames up to the target
+        std::int16_t      buffer[4096];
+        const ogg_int64_t frameSize = static_cast<ogg_int64_t>(m_channelCount * sizeof(std::int16_t));
+        while (position < frameOffset)
+        {
+            const ogg_int64_t bytes = std::min((frameOffset - position) * frameSize,
+                                               static_cast<ogg_int64_t>(sizeof(buffer)) / frameSize * frameSize);
+            const long        bytesRead =
+                ov_read(&m_vorbis, reinterpret_cast<char*>(buffer), static_cast<int>(bytes), 0, 2, 1, nullptr);
+            if (bytesRead <= 0)
+                return false;
+
+            position += bytesRead / frameSize;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
 } // namespace priv
 
 } // namespace sf
@@ -31,6 +31,8 @@
 
 #include <vorbis/vorbisfile.h>
 
+#include <vector>
+
 
 namespace sf
 {
@@ -110,11 +112,52 @@ private:
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Extend the seek index up to the given frame
+    ///
+    /// The pages following the indexed part of the file are
+    /// scanned, without being decoded, and the ones starting
+    /// a new fraction of a second are recorded. The index is
+    /// built on demand, so that files which are not seeked
+    /// into are not read twice, and each page is scanned
+    /// only once.
+    ///
+    /// \param frameOffset Index of the frame that the index must cover
+    ///
+    ////////////////////////////////////////////////////////////
+    void extendSeekIndex(ogg_int64_t frameOffset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Seek to the given frame using the seek index
+    ///
+    /// \param frameOffset Index of the frame to jump to
+    ///
+    /// The index is extended first if it doesn't cover the
+    /// target yet.
+    ///
+    /// \return True if the position was found in the index, false if a regular seek is needed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool seekFromIndex(ogg_int64_t frameOffset);
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    struct SeekPoint
+    {
+        ogg_int64_t frameOffset; //!< Frame at which the page starts (its decoding may start a bit later)
+        ogg_int64_t byteOffset;  //!< Offset of the page in the physical stream
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    OggVorbis_File m_vorbis;       // ogg/vorbis file handle
-    unsigned int   m_channelCount; // number of channels of the open sound file
+    OggVorbis_File         m_vorbis;        // ogg/vorbis file handle
+    unsigned int           m_channelCount;  // number of channels of the open sound file
+    ogg_int64_t            m_indexInterval; // minimum number of frames between two points of the seek index
+    ogg_int64_t            m_scanOffset;    // offset of the first page not indexed yet
+    ogg_int64_t            m_scanFrame;     // frame at which this page starts
+    std::vector<SeekPoint> m_seekIndex;     // start of the indexed pages, sorted by frame offset
 };
 
 } // namespace priv
@@ -31,6 +31,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Sleep.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <ostream>
@@ -106,8 +107,8 @@ bool SoundRecorder::start(unsigned int sampleRate)
         return false;
     }
 
-    // Clear the array of samples
-    m_samples.clear();
+    // Allocate the array of samples once, as large as the capture buffer (1 second)
+    m_samples.assign(static_cast<std::size_t>(sampleRate) * m_channelCount, 0);
 
     // Store the sample rate
     m_sampleRate = sampleRate;
@@ -286,8 +287,9 @@ void SoundRecorder::record()
         // Process available samples
         processCapturedSamples();
 
-        // Don't bother the CPU while waiting for more captured data
-        sleep(m_processingInterval);
+        // Don't bother the CPU while waiting for more captured data,
+        // but wake up as soon as a full interval is expected to be captured
+        sleep(getCaptureDelay());
     }
 
     // Capture is finished: clean up everything
@@ -304,12 +306,13 @@ void SoundRecorder::processCapturedSamples()
 
     if (samplesAvailable > 0)
     {
-        // Get the recorded samples
-        m_samples.resize(static_cast<std::size_t>(samplesAvailable) * getChannelCount());
-        alcCaptureSamples(captureDevice, m_samples.data(), samplesAvailable);
+        // Get the recorded samples, the array is as large as the capture buffer so it never has to grow
+        const std::size_t frames = std::min(static_cast<std::size_t>(samplesAvailable),
+                                            m_samples.size() / getChannelCount());
+        alcCaptureSamples(captureDevice, m_samples.data(), static_cast<ALCsizei>(frames));
 
         // Forward them to the derived class
-        if (!onProcessSamples(m_samples.data(), m_samples.size()))
+        if (!onProcessSamples(m_samples.data(), frames * getChannelCount()))
         {
             // The user wants to stop the capture
             m_isCapturing = false;
@@ -318,6 +321,22 @@ void SoundRecorder::processCapturedSamples()
 }
 
 
+////////////////////////////////////////////////////////////
+Time SoundRecorder::getCaptureDelay() const
+{
+    // Samples may have been captured while the previous ones were processed
+    ALCint samplesAvailable = 0;
+    alcGetIntegerv(captureDevice, ALC_CAPTURE_SAMPLES, 1, &samplesAvailable);
+
+    // Number of samples expected in a processing interval
+    const std::int64_t intervalSamples = m_processingInterval.asMicroseconds() * m_sampleRate / 1000000;
+    if (samplesAvailable >= intervalSamples)
+        return Time::Zero;
+
+    return microseconds((intervalSamples - samplesAvailable) * 1000000 / m_sampleRate);
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundRecorder::cleanup()
 {
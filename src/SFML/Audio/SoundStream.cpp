@@ -28,8 +28,9 @@
 #include <SFML/Audio/ALCheck.hpp>
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/SoundStream.hpp>
+#include <SFML/Audio/StreamScheduler.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Trace.hpp>
 
 #include <cassert>
 #include <mutex>
@@ -47,10 +48,11 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 SoundStream::SoundStream() :
-m_thread(),
+m_isScheduled(false),
 m_threadMutex(),
 m_threadStartState(Stopped),
 m_isStreaming(false),
+m_requestStop(false),
 m_buffers(),
 m_channelCount(0),
 m_sampleRate(0),
@@ -60,6 +62,7 @@ m_samplesProcessed(0),
 m_bufferSeeks(),
 m_processingInterval(milliseconds(10))
 {
+    priv::StreamScheduler::acquire();
 }
 
 
@@ -68,8 +71,10 @@ SoundStream::~SoundStream()
 {
     // Stop the sound if it was playing
 
-    // Wait for the thread to join
+    // Wait for the scheduler to release the stream
     awaitStreamingThread();
+
+    priv::StreamScheduler::release();
 }
 
 
@@ -133,14 +138,14 @@ void SoundStream::play()
         // If the sound is playing, stop it and continue as if it was stopped
         stop();
     }
-    else if (!isStreaming && m_thread.joinable())
+    else if (!isStreaming && m_isScheduled)
     {
-        // If the streaming thread reached its end, let it join so it can be restarted.
+        // If the streaming loop reached its end, let it be released so it can be restarted.
         // Also reset the playing offset at the beginning.
         stop();
     }
 
-    // Start updating the stream in a separate thread to avoid blocking the application
+    // Start updating the stream in the background to avoid blocking the application
     launchStreamingThread(Playing);
 }
 
@@ -165,7 +170,7 @@ void SoundStream::pause()
 ////////////////////////////////////////////////////////////
 void SoundStream::stop()
 {
-    // Wait for the thread to join
+    // Wait for the scheduler to release the stream
     awaitStreamingThread();
 
     // Move to the beginning
@@ -274,18 +279,16 @@ void SoundStream::setProcessingInterval(Time interval)
 }
 
 ////////////////////////////////////////////////////////////
-void SoundStream::streamData()
+bool SoundStream::startStreaming()
 {
-    bool requestStop = false;
-
     {
         std::scoped_lock lock(m_threadMutex);
 
-        // Check if the thread was launched Stopped
+        // Check if the stream was launched Stopped
         if (m_threadStartState == Stopped)
         {
             m_isStreaming = false;
-            return;
+            return false;
         }
     }
 
@@ -295,7 +298,7 @@ void SoundStream::streamData()
         bufferSeek = NoLoop;
 
     // Fill the queue
-    requestStop = fillQueue();
+    m_requestStop = fillQueue();
 
     // Play the sound
     alCheck(alSourcePlay(m_source));
@@ -303,107 +306,127 @@ void SoundStream::streamData()
     {
         std::scoped_lock lock(m_threadMutex);
 
-        // Check if the thread was launched Paused
+        // Check if the stream was launched Paused
         if (m_threadStartState == Paused)
             alCheck(alSourcePause(m_source));
     }
 
-    for (;;)
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundStream::updateStreaming()
+{
+    SFML_TRACE_ZONE("SoundStream::updateStreaming");
+
+    bool isStreaming = false;
+
+    {
+        std::scoped_lock lock(m_threadMutex);
+        isStreaming = m_isStreaming;
+    }
+
+    if (!isStreaming)
     {
+        finishStreaming();
+        return false;
+    }
+
+    // The stream has been interrupted!
+    if (SoundSource::getStatus() == Stopped)
+    {
+        if (!m_requestStop)
+        {
+            // Just continue
+            alCheck(alSourcePlay(m_source));
+        }
+        else
         {
+            // End streaming
             std::scoped_lock lock(m_threadMutex);
-            if (!m_isStreaming)
-                break;
+            m_isStreaming = false;
         }
+    }
 
-        // The stream has been interrupted!
-        if (SoundSource::getStatus() == Stopped)
-        {
-            if (!requestStop)
-            {
-                // Just continue
-                alCheck(alSourcePlay(m_source));
-            }
-            else
+    // Get the number of buffers that have been processed (i.e. ready for reuse)
+    ALint nbProcessed = 0;
+    alCheck(alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &nbProcessed));
+
+    while (nbProcessed--)
+    {
+        // Pop the first unused buffer from the queue
+        ALuint buffer;
+        alCheck(alSourceUnqueueBuffers(m_source, 1, &buffer));
+
+        // Find its number
+        unsigned int bufferNum = 0;
+        for (unsigned int i = 0; i < BufferCount; ++i)
+            if (m_buffers[i] == buffer)
             {
-                // End streaming
-                std::scoped_lock lock(m_threadMutex);
-                m_isStreaming = false;
+                bufferNum = i;
+                break;
             }
-        }
-
-        // Get the number of buffers that have been processed (i.e. ready for reuse)
-        ALint nbProcessed = 0;
-        alCheck(alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &nbProcessed));
 
-        while (nbProcessed--)
+        // Retrieve its size and add it to the samples count
+        if (m_bufferSeeks[bufferNum] != NoLoop)
         {
-            // Pop the first unused buffer from the queue
-            ALuint buffer;
-            alCheck(alSourceUnqueueBuffers(m_source, 1, &buffer));
-
-            // Find its number
-            unsigned int bufferNum = 0;
-            for (unsigned int i = 0; i < BufferCount; ++i)
-                if (m_buffers[i] == buffer)
-                {
-                    bufferNum = i;
-                    break;
-                }
-
-            // Retrieve its size and add it to the samples count
-            if (m_bufferSeeks[bufferNum] != NoLoop)
+            // This was the last buffer before EOF or Loop End: reset the sample count
+            m_samplesProcessed       = static_cast<std::uint64_t>(m_bufferSeeks[bufferNum]);
+            m_bufferSeeks[bufferNum] = NoLoop;
+        }
+        else
+        {
+            ALint size, bits;
+            alCheck(alGetBufferi(buffer, AL_SIZE, &size));
+            alCheck(alGetBufferi(buffer, AL_BITS, &bits));
+
+            // Bits can be 0 if the format or parameters are corrupt, avoid division by zero
+            if (bits == 0)
             {
-                // This was the last buffer before EOF or Loop End: reset the sample count
-                m_samplesProcessed       = static_cast<std::uint64_t>(m_bufferSeeks[bufferNum]);
-                m_bufferSeeks[bufferNum] = NoLoop;
+                err() << "Bits in sound stream are 0: make sure that the audio format is not corrupt "
+                      << "and initialize() has been called correctly" << std::endl;
+
+                // Abort streaming (exit main loop)
+                std::scoped_lock lock(m_threadMutex);
+                m_isStreaming = false;
+                m_requestStop = true;
+                break;
             }
             else
             {
-                ALint size, bits;
-                alCheck(alGetBufferi(buffer, AL_SIZE, &size));
-                alCheck(alGetBufferi(buffer, AL_BITS, &bits));
-
-                // Bits can be 0 if the format or parameters are corrupt, avoid division by zero
-                if (bits == 0)
-                {
-                    err() << "Bits in sound stream are 0: make sure that the audio format is not corrupt "
-                          << "and initialize() has been called correctly" << std::endl;
-
-                    // Abort streaming (exit main loop)
-                    std::scoped_lock lock(m_threadMutex);
-                    m_isStreaming = false;
-                    requestStop   = true;
-                    break;
-                }
-                else
-                {
-                    m_samplesProcessed += static_cast<std::uint64_t>(size / (bits / 8));
-                }
+                m_samplesProcessed += static_cast<std::uint64_t>(size / (bits / 8));
             }
+        }
 
-            // Fill it and push it back into the playing queue
-            if (!requestStop)
-            {
-                if (fillAndPushBuffer(bufferNum))
-                    requestStop = true;
-            }
+        // Fill it and push it back into the playing queue
+        if (!m_requestStop)
+        {
+            if (fillAndPushBuffer(bufferNum))
+                m_requestStop = true;
         }
+    }
 
-        // Check if any error has occurred
-        if (alGetLastError() != AL_NO_ERROR)
+    // Check if any error has occurred
+    if (alGetLastError() != AL_NO_ERROR)
+    {
+        // Abort streaming (exit main loop)
         {
-            // Abort streaming (exit main loop)
             std::scoped_lock lock(m_threadMutex);
             m_isStreaming = false;
-            break;
         }
 
-        // Leave some time for the other threads if the stream is still playing
-        if (SoundSource::getStatus() != Stopped)
-            sleep(m_processingInterval);
+        finishStreaming();
+        return false;
     }
 
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundStream::finishStreaming()
+{
     // Stop the playback
     alCheck(alSourceStop(m_source));
 
@@ -422,6 +445,8 @@ void SoundStream::streamData()
 ////////////////////////////////////////////////////////////
 bool SoundStream::fillAndPushBuffer(unsigned int bufferNum, bool immediateLoop)
 {
+    SFML_TRACE_ZONE("SoundStream::fillAndPushBuffer");
+
     bool requestStop = false;
 
     // Acquire audio data, also address EOF and error cases if they occur
@@ -519,22 +544,26 @@ void SoundStream::launchStreamingThread(Status threadStartState)
         m_threadStartState = threadStartState;
     }
 
-    assert(!m_thread.joinable());
-    m_thread = std::thread(&SoundStream::streamData, this);
+    assert(!m_isScheduled);
+    m_isScheduled = true;
+    priv::StreamScheduler::add(*this);
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundStream::awaitStreamingThread()
 {
-    // Request the thread to join
+    // Request the streaming loop to end
     {
         std::scoped_lock lock(m_threadMutex);
         m_isStreaming = false;
     }
 
-    if (m_thread.joinable())
-        m_thread.join();
+    if (m_isScheduled)
+    {
+        priv::StreamScheduler::remove(*this);
+        m_isScheduled = false;
+    }
 }
 
 } // namespace sf
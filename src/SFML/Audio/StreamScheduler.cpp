@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundStream.hpp>
+#include <SFML/Audio/StreamScheduler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// A stream serviced by the scheduler thread
+struct Entry
+{
+    sf::SoundStream*  stream;          // Stream to update
+    Clock::time_point deadline;        // Time at which the stream must be updated next
+    bool              started;         // Has the streaming loop been started for this stream?
+    bool              removeRequested; // Is a thread waiting for this stream to finish?
+};
+
+// Scheduled streams and the synchronization objects protecting them
+struct Scheduler
+{
+    ~Scheduler()
+    {
+        // Streams may still be registered when the program exits (leaked or static sf::Music
+        // instances), the thread must not outlive the scheduler nor be destroyed while joinable
+        std::scoped_lock lock(threadMutex);
+
+        if (thread.joinable())
+        {
+            {
+                std::scoped_lock entriesLock(entriesMutex);
+                shutdown = true;
+            }
+
+            wakeUp.notify_all();
+            thread.join();
+        }
+    }
+
+    std::vector<Entry>      entries;
+    std::mutex              entriesMutex;
+    std::condition_variable wakeUp;   // Notified when the scheduler must re-check its deadlines
+    std::condition_variable finished; // Notified when a stream has been removed from the schedule
+    bool                    shutdown{false};
+
+    // Lifetime of the scheduler thread: it lives as long as sound streams exist.
+    // This mutex is never locked by the scheduler thread itself, so it can be held while joining.
+    unsigned int count{0};
+    std::mutex   threadMutex;
+    std::thread  thread;
+};
+
+
+////////////////////////////////////////////////////////////
+Scheduler& getScheduler()
+{
+    // Constructed by the first sound stream, so it is destroyed after the streams which are static objects
+    static Scheduler scheduler;
+    return scheduler;
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Entry>::iterator findEntry(std::vector<Entry>& entries, const sf::SoundStream* stream)
+{
+    return std::find_if(entries.begin(),
+                        entries.end(),
+                        [stream](const Entry& entry) { return entry.stream == stream; });
+}
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void StreamScheduler::acquire()
+{
+    Scheduler&       scheduler = getScheduler();
+    std::scoped_lock lock(scheduler.threadMutex);
+    ++scheduler.count;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::release()
+{
+    Scheduler&       scheduler = getScheduler();
+    std::scoped_lock lock(scheduler.threadMutex);
+
+    // If there's no more stream alive, we can stop the scheduler thread
+    if (--scheduler.count > 0)
+        return;
+
+    if (scheduler.thread.joinable())
+    {
+        {
+            std::scoped_lock entriesLock(scheduler.entriesMutex);
+            scheduler.shutdown = true;
+        }
+
+        scheduler.wakeUp.notify_all();
+        scheduler.thread.join();
+        scheduler.shutdown = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::add(SoundStream& stream)
+{
+    Scheduler&       scheduler = getScheduler();
+    std::scoped_lock lock(scheduler.threadMutex);
+
+    // The scheduler thread is started on demand
+    if (!scheduler.thread.joinable())
+        scheduler.thread = std::thread(&StreamScheduler::run);
+
+    {
+        std::scoped_lock entriesLock(scheduler.entriesMutex);
+        scheduler.entries.push_back({&stream, Clock::now(), false, false});
+    }
+
+    scheduler.wakeUp.notify_all();
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::remove(SoundStream& stream)
+{
+    Scheduler&       scheduler = getScheduler();
+    std::unique_lock lock(scheduler.entriesMutex);
+
+    auto entry = findEntry(scheduler.entries, &stream);
+    if (entry == scheduler.entries.end())
+        return;
+
+    // Make the scheduler process the stream as soon as possible, so that it notices it must stop
+    entry->deadline        = Clock::now();
+    entry->removeRequested = true;
+    scheduler.wakeUp.notify_all();
+
+    scheduler.finished.wait(lock,
+                            [&scheduler, &stream]
+                            { return findEntry(scheduler.entries, &stream) == scheduler.entries.end(); });
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::run()
+{
+    Scheduler&       scheduler = getScheduler();
+    std::unique_lock lock(scheduler.entriesMutex);
+
+    while (!scheduler.shutdown)
+    {
+        if (scheduler.entries.empty())
+        {
+            scheduler.wakeUp.wait(lock);
+            continue;
+        }
+
+        // Pick the stream whose deadline comes first
+        auto next = std::min_element(scheduler.entries.begin(),
+                                     scheduler.entries.end(),
+                                     [](const Entry& a, const Entry& b) { return a.deadline < b.deadline; });
+
+        if (next->deadline > Clock::now())
+        {
+            scheduler.wakeUp.wait_until(lock, next->deadline);
+            continue;
+        }
+
+        SoundStream* stream  = next->stream;
+        const bool   started = next->started;
+        next->started        = true;
+
+        // Update the stream without holding the lock, onGetData() may take a while
+        lock.unlock();
+        const bool keepStreaming = started ? stream->updateStreaming() : stream->startStreaming();
+        lock.lock();
+
+        // The vector may have been modified while we were updating the stream
+        next = findEntry(scheduler.entries, stream);
+
+        if (keepStreaming)
+        {
+            // Leave some time for the other streams if this one is still playing
+            next->deadline = Clock::now();
+            if (!next->removeRequested && (stream->SoundSource::getStatus() != SoundSource::Stopped))
+                next->deadline += stream->m_processingInterval.toDuration();
+        }
+        else
+        {
+            scheduler.entries.erase(next);
+            scheduler.finished.notify_all();
+        }
+    }
+}
+
+} // namespace sf::priv
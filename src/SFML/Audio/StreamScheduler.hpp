@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+
+namespace sf
+{
+class SoundStream;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Shared background thread servicing all the
+///        playing sound streams
+///
+/// Instead of running one thread per sf::SoundStream, every
+/// playing stream is registered to a single scheduler thread
+/// which keeps a deadline per stream and updates the ones
+/// that are due, sleeping until the next deadline otherwise.
+///
+////////////////////////////////////////////////////////////
+class StreamScheduler
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a new sound stream object
+    ///
+    /// The scheduler thread is kept alive as long as at least
+    /// one sound stream exists.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void acquire();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unregister a sound stream object
+    ///
+    /// When the last sound stream is released, the scheduler
+    /// thread is stopped and joined.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void release();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start servicing a stream
+    ///
+    /// The stream will be updated from the scheduler thread
+    /// until it finishes or is removed.
+    ///
+    /// \param stream Stream to schedule
+    ///
+    ////////////////////////////////////////////////////////////
+    static void add(SoundStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a stream is no longer serviced
+    ///
+    /// The stream must have been told to stop streaming before
+    /// calling this function. It blocks until the scheduler has
+    /// finished the stream (released its buffers), and returns
+    /// immediately if the stream already finished by itself.
+    ///
+    /// \param stream Stream to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    static void remove(SoundStream& stream);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry point of the scheduler thread
+    ///
+    /// Updates the scheduled streams as their deadlines expire,
+    /// until the scheduler is shut down.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void run();
+};
+
+} // namespace priv
+
+} // namespace sf
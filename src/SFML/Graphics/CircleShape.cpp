@@ -28,12 +28,51 @@
 #include <SFML/Graphics/CircleShape.hpp>
 
 #include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CircleShapeImpl
+{
+// Get the points of the unit circle centered on the origin, starting at the top
+std::shared_ptr<const std::vector<sf::Vector2f>> getUnitCircle(std::size_t pointCount)
+{
+    // Tables are shared by all the circles with the same point count, and
+    // released when the last of them changes its point count or is destroyed
+    static std::mutex mutex;
+    static std::unordered_map<std::size_t, std::weak_ptr<const std::vector<sf::Vector2f>>> tables;
+
+    std::scoped_lock lock(mutex);
+
+    std::weak_ptr<const std::vector<sf::Vector2f>>& cached = tables[pointCount];
+    if (auto table = cached.lock())
+        return table;
+
+    auto table = std::make_shared<std::vector<sf::Vector2f>>(pointCount);
+    for (std::size_t i = 0; i < pointCount; ++i)
+    {
+        const sf::Angle angle = static_cast<float>(i) / static_cast<float>(pointCount) * sf::degrees(360) -
+                                sf::degrees(90);
+        (*table)[i] = sf::Vector2f(1.f, angle);
+    }
+
+    cached = table;
+    return table;
+}
+} // namespace CircleShapeImpl
+} // namespace
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-CircleShape::CircleShape(float radius, std::size_t pointCount) : m_radius(radius), m_pointCount(pointCount)
+CircleShape::CircleShape(float radius, std::size_t pointCount) :
+m_radius(radius),
+m_pointCount(pointCount),
+m_unitCircle(CircleShapeImpl::getUnitCircle(pointCount))
 {
     update();
 }
@@ -42,6 +81,9 @@ CircleShape::CircleShape(float radius, std::size_t pointCount) : m_radius(radius
 ////////////////////////////////////////////////////////////
 void CircleShape::setRadius(float radius)
 {
+    if (radius == m_radius)
+        return;
+
     m_radius = radius;
     update();
 }
@@ -57,10 +99,15 @@ float CircleShape::getRadius() const
 ////////////////////////////////////////////////////////////
 void CircleShape::setPointCount(std::size_t count)
 {
+    if (count == m_pointCount)
+        return;
+
     m_pointCount = count;
+    m_unitCircle = CircleShapeImpl::getUnitCircle(count);
     update();
 }
 
+
 ////////////////////////////////////////////////////////////
 std::size_t CircleShape::getPointCount() const
 {
@@ -71,8 +118,17 @@ std::size_t CircleShape::getPointCount() const
 ////////////////////////////////////////////////////////////
 Vector2f CircleShape::getPoint(std::size_t index) const
 {
-    Angle angle = static_cast<float>(index) / static_cast<float>(m_pointCount) * sf::degrees(360) - sf::degrees(90);
-    return Vector2f(m_radius, m_radius) + Vector2f(m_radius, angle);
+    return Vector2f(m_radius, m_radius) + (*m_unitCircle)[index] * m_radius;
+}
+
+
+////////////////////////////////////////////////////////////
+void CircleShape::getPoints(Vector2f* points) const
+{
+    const Vector2f center(m_radius, m_radius);
+
+    for (std::size_t i = 0; i < m_pointCount; ++i)
+        points[i] = center + (*m_unitCircle)[i] * m_radius;
 }
 
 } // namespace sf
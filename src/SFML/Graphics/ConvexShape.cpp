@@ -27,6 +27,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/ConvexShape.hpp>
 
+#include <algorithm>
+
 
 namespace sf
 {
@@ -66,4 +68,11 @@ Vector2f ConvexShape::getPoint(std::size_t index) const
     return m_points[index];
 }
 
+
+////////////////////////////////////////////////////////////
+void ConvexShape::getPoints(Vector2f* points) const
+{
+    std::copy(m_points.begin(), m_points.end(), points);
+}
+
 } // namespace sf
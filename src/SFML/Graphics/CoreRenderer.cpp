@@ -0,0 +1,624 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoreRenderer.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/Window/Context.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <unordered_set>
+#include <utility>
+
+
+#ifndef SFML_OPENGL_ES
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CoreRendererImpl
+{
+// Built-in uniforms, as bits of the dirty mask
+enum Uniform : unsigned int
+{
+    Projection    = 1 << 0,
+    ModelView     = 1 << 1,
+    TextureMatrix = 1 << 2,
+    Textured      = 1 << 3
+};
+
+// The built-in program reproduces the fixed-function pipeline used by the compatibility path
+constexpr const char* vertexShaderSource = R"(#version 330 core
+layout(location = 0) in vec2 sf_position;
+layout(location = 1) in vec4 sf_color;
+layout(location = 2) in vec2 sf_texCoords;
+
+uniform mat4 sf_projection;
+uniform mat4 sf_modelView;
+uniform mat4 sf_textureMatrix;
+
+out vec4 sf_vertexColor;
+out vec2 sf_vertexTexCoords;
+
+void main()
+{
+    gl_Position        = sf_projection * sf_modelView * vec4(sf_position, 0.0, 1.0);
+    sf_vertexColor     = sf_color;
+    sf_vertexTexCoords = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;
+}
+)";
+
+constexpr const char* fragmentShaderSource = R"(#version 330 core
+uniform sampler2D sf_texture;
+uniform bool      sf_textured;
+
+in vec4 sf_vertexColor;
+in vec2 sf_vertexTexCoords;
+
+out vec4 sf_fragColor;
+
+void main()
+{
+    sf_fragColor = sf_textured ? sf_vertexColor * texture(sf_texture, sf_vertexTexCoords) : sf_vertexColor;
+}
+)";
+
+// Compile a shader of the built-in program, return 0 on failure
+GLuint compileShader(GLenum type, const char* source)
+{
+    GLuint shader = 0;
+    glCheck(shader = glCreateShader(type));
+    glCheck(glShaderSource(shader, 1, &source, nullptr));
+    glCheck(glCompileShader(shader));
+
+    GLint success = GL_FALSE;
+    glCheck(glGetShaderiv(shader, GL_COMPILE_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        char log[1024];
+        glCheck(glGetShaderInfoLog(shader, sizeof(log), nullptr, log));
+        sf::err() << "Failed to compile built-in " << (type == GL_VERTEX_SHADER ? "vertex" : "fragment")
+                  << " shader:" << '\n'
+                  << log << std::endl;
+        glCheck(glDeleteShader(shader));
+        return 0;
+    }
+
+    return shader;
+}
+
+// Set to track the vertex array objects of all living renderers
+// This is used to free them when their context is destroyed first
+std::unordered_set<std::unordered_map<std::uint64_t, unsigned int>*> vertexArrays;
+
+// Set to track all stale vertex array objects
+// Vertex array objects are not shared between contexts, the ones that
+// a renderer created in other contexts can't be destroyed until these
+// contexts become active, or are destroyed themselves
+std::set<std::pair<std::uint64_t, unsigned int>> staleVertexArrays;
+
+// Mutex to protect both active and stale vertex array sets
+std::recursive_mutex vertexArrayMutex;
+
+// Destroy the stale vertex array objects of the active context
+void destroyStaleVertexArrays()
+{
+    const std::uint64_t contextId = sf::Context::getActiveContextId();
+
+    for (auto it = staleVertexArrays.begin(); it != staleVertexArrays.end();)
+    {
+        if (it->first == contextId)
+        {
+            auto vertexArray = static_cast<GLuint>(it->second);
+            glCheck(GLEXT_glDeleteVertexArrays(1, &vertexArray));
+
+            staleVertexArrays.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+// Callback that is called every time a context is destroyed
+void contextDestroyCallback(void* /*arg*/)
+{
+    std::scoped_lock lock(vertexArrayMutex);
+
+    const std::uint64_t contextId = sf::Context::getActiveContextId();
+
+    // Destroy the vertex array objects that living renderers created in this context
+    for (auto* vertexArray : vertexArrays)
+    {
+        if (auto it = vertexArray->find(contextId); it != vertexArray->end())
+        {
+            glCheck(GLEXT_glDeleteVertexArrays(1, &it->second));
+            vertexArray->erase(it);
+        }
+    }
+
+    destroyStaleVertexArrays();
+}
+
+} // namespace CoreRendererImpl
+} // namespace
+
+#endif // SFML_OPENGL_ES
+
+
+namespace sf
+{
+namespace priv
+{
+#ifndef SFML_OPENGL_ES
+
+////////////////////////////////////////////////////////////
+struct CoreRenderer::Program
+{
+    ////////////////////////////////////////////////////////////
+    Program()
+    {
+        using namespace CoreRendererImpl;
+
+        const GLuint vertexShader   = compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+        const GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+
+        if (vertexShader && fragmentShader)
+        {
+            GLuint program = 0;
+            glCheck(program = glCreateProgram());
+            glCheck(glAttachShader(program, vertexShader));
+            glCheck(glAttachShader(program, fragmentShader));
+            glCheck(glLinkProgram(program));
+
+            GLint success = GL_FALSE;
+            glCheck(glGetProgramiv(program, GL_LINK_STATUS, &success));
+            if (success == GL_FALSE)
+            {
+                char log[1024];
+                glCheck(glGetProgramInfoLog(program, sizeof(log), nullptr, log));
+                err() << "Failed to link built-in shader:" << '\n' << log << std::endl;
+                glCheck(glDeleteProgram(program));
+            }
+            else
+            {
+                handle                  = program;
+                locations.projection    = glGetUniformLocation(program, "sf_projection");
+                locations.modelView     = glGetUniformLocation(program, "sf_modelView");
+                locations.textureMatrix = glGetUniformLocation(program, "sf_textureMatrix");
+                locations.textured      = glGetUniformLocation(program, "sf_textured");
+
+                // The texture is always bound to the first unit
+                glCheck(glUseProgram(program));
+                glCheck(glUniform1i(glGetUniformLocation(program, "sf_texture"), 0));
+            }
+        }
+
+        // The program keeps the shaders alive as long as it needs them
+        if (vertexShader)
+            glCheck(glDeleteShader(vertexShader));
+        if (fragmentShader)
+            glCheck(glDeleteShader(fragmentShader));
+    }
+
+    ////////////////////////////////////////////////////////////
+    ~Program()
+    {
+        TransientContextLock lock;
+
+        if (handle)
+            glCheck(glDeleteProgram(handle));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GLuint                           handle{0}; //!< OpenGL name of the program
+    Locations                        locations; //!< Locations of the built-in uniforms
+    std::atomic<const CoreRenderer*> user{};    //!< Renderer whose uniforms the program holds
+};
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderer::isCoreProfile()
+{
+    // Make sure that extensions are initialized
+    ensureExtensionsInit();
+
+    GLint majorVersion = 0;
+    GLint minorVersion = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+
+    // Contexts older than 3.0 don't know these queries
+    if ((glGetError() == GL_INVALID_ENUM) || (majorVersion * 10 + minorVersion < 33))
+        return false;
+
+    GLint profileMask = 0;
+    glCheck(glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &profileMask));
+
+    // Entry points are loaded once for all contexts, make sure that the ones we need exist
+    return (profileMask & GL_CONTEXT_CORE_PROFILE_BIT) && glCreateProgram && GLEXT_glGenVertexArrays &&
+           glVertexAttribPointer && glDrawElementsBaseVertex;
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderer::CoreRenderer()
+{
+    using namespace CoreRendererImpl;
+
+    TransientContextLock lock;
+
+    m_program = getProgram();
+
+    {
+        std::scoped_lock vertexArrayLock(vertexArrayMutex);
+
+        // Register the context destruction callback
+        registerContextDestroyCallback(contextDestroyCallback, nullptr);
+
+        // Insert the vertex array mapping into the set of all active mappings
+        vertexArrays.insert(&m_vertexArrays);
+    }
+
+    // Start with identity matrices
+    for (auto* matrix : {&m_projection, &m_modelView, &m_textureMatrix})
+    {
+        matrix->fill(0.f);
+        (*matrix)[0] = (*matrix)[5] = (*matrix)[10] = (*matrix)[15] = 1.f;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderer::~CoreRenderer()
+{
+    using namespace CoreRendererImpl;
+
+    TransientContextLock lock;
+
+    {
+        std::scoped_lock vertexArrayLock(vertexArrayMutex);
+
+        // Remove the vertex array mapping from the set of all active mappings
+        vertexArrays.erase(&m_vertexArrays);
+
+        // Vertex array objects can only be destroyed in the context that created them,
+        // the other ones are destroyed when their context becomes active or is destroyed
+        for (const auto& [contextId, vertexArray] : m_vertexArrays)
+            staleVertexArrays.emplace(contextId, vertexArray);
+
+        destroyStaleVertexArrays();
+    }
+
+    if (m_indexBuffer)
+        glCheck(glDeleteBuffers(1, &m_indexBuffer));
+
+    // The next renderer using the program must upload all its uniforms again
+    const CoreRenderer* self = this;
+    m_program->user.compare_exchange_strong(self, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::bind()
+{
+    {
+        std::scoped_lock lock(CoreRendererImpl::vertexArrayMutex);
+
+        // Take the opportunity to free the objects that other renderers left in this context
+        CoreRendererImpl::destroyStaleVertexArrays();
+
+        auto [it, inserted] = m_vertexArrays.try_emplace(Context::getActiveContextId(), 0u);
+
+        if (inserted)
+        {
+            glCheck(GLEXT_glGenVertexArrays(1, &it->second));
+            glCheck(GLEXT_glBindVertexArray(it->second));
+
+            for (GLuint attribute = 0; attribute < 3; ++attribute)
+                glCheck(glEnableVertexAttribArray(attribute));
+        }
+        else
+        {
+            glCheck(GLEXT_glBindVertexArray(it->second));
+        }
+    }
+
+    glCheck(glUseProgram(m_program->handle));
+    m_userProgram = 0;
+
+    // The vertex array object may not point to our buffers (new object, or other context)
+    m_attributeBuffer = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::useProgram(unsigned int program)
+{
+    if (!program && m_userProgram)
+        glCheck(glUseProgram(m_program->handle));
+
+    m_userProgram = program;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setProjection(const float* matrix)
+{
+    if (!std::equal(m_projection.begin(), m_projection.end(), matrix))
+    {
+        std::copy(matrix, matrix + 16, m_projection.begin());
+        m_dirtyUniforms |= CoreRendererImpl::Projection;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setModelView(const float* matrix)
+{
+    if (!std::equal(m_modelView.begin(), m_modelView.end(), matrix))
+    {
+        std::copy(matrix, matrix + 16, m_modelView.begin());
+        m_dirtyUniforms |= CoreRendererImpl::ModelView;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setTextureMatrix(const float* matrix)
+{
+    if (m_textured != (matrix != nullptr))
+    {
+        m_textured = (matrix != nullptr);
+        m_dirtyUniforms |= CoreRendererImpl::Textured;
+    }
+
+    if (matrix && !std::equal(m_textureMatrix.begin(), m_textureMatrix.end(), matrix))
+    {
+        std::copy(matrix, matrix + 16, m_textureMatrix.begin());
+        m_dirtyUniforms |= CoreRendererImpl::TextureMatrix;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CoreRenderer::streamVertices(const Vertex* vertices, std::size_t vertexCount)
+{
+    const std::size_t firstVertex = m_stream.write(vertices, vertexCount);
+
+    // The stream gets a new handle when it grows, the attributes must follow it
+    setAttributeBuffer(m_stream.getNativeHandle());
+
+    return firstVertex;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::bindVertexBuffer(unsigned int buffer)
+{
+    // Always point the attributes again, the buffer may have been recreated with the same name
+    m_attributeBuffer = 0;
+    setAttributeBuffer(buffer);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::streamIndices(const std::uint32_t* indices, std::size_t indexCount)
+{
+    if (!m_indexBuffer)
+        glCheck(glGenBuffers(1, &m_indexBuffer));
+
+    // The binding is part of the vertex array object, which may be shared with other targets of the context
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+
+    // Orphan the storage at each draw, the driver hands out a new one instead of waiting for the GPU
+    glCheck(glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                         static_cast<GLsizeiptr>(sizeof(std::uint32_t) * indexCount),
+                         indices,
+                         GL_STREAM_DRAW));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::bindIndexBuffer(unsigned int buffer)
+{
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::applyUniforms()
+{
+    using namespace CoreRendererImpl;
+
+    // Programs of sf::Shader get all the uniforms before each draw, they are bound for a single draw anyway
+    Locations    locations = m_program->locations;
+    unsigned int mask      = m_dirtyUniforms;
+    if (m_userProgram)
+    {
+        locations.projection    = glGetUniformLocation(m_userProgram, "sf_projection");
+        locations.modelView     = glGetUniformLocation(m_userProgram, "sf_modelView");
+        locations.textureMatrix = glGetUniformLocation(m_userProgram, "sf_textureMatrix");
+        locations.textured      = glGetUniformLocation(m_userProgram, "sf_textured");
+        mask                    = Projection | ModelView | TextureMatrix | Textured;
+    }
+    else
+    {
+        // The built-in program is shared, it holds the uniforms of the last renderer that drew with it
+        if (m_program->user.exchange(this) != this)
+            mask = Projection | ModelView | TextureMatrix | Textured;
+
+        m_dirtyUniforms = 0;
+    }
+
+    if ((mask & Projection) && (locations.projection != -1))
+        glCheck(glUniformMatrix4fv(locations.projection, 1, GL_FALSE, m_projection.data()));
+
+    if ((mask & ModelView) && (locations.modelView != -1))
+        glCheck(glUniformMatrix4fv(locations.modelView, 1, GL_FALSE, m_modelView.data()));
+
+    if ((mask & TextureMatrix) && (locations.textureMatrix != -1))
+        glCheck(glUniformMatrix4fv(locations.textureMatrix, 1, GL_FALSE, m_textureMatrix.data()));
+
+    if ((mask & Textured) && (locations.textured != -1))
+        glCheck(glUniform1i(locations.textured, m_textured ? 1 : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+std::shared_ptr<CoreRenderer::Program> CoreRenderer::getProgram()
+{
+    // All SFML contexts share their objects, a single program serves all of them.
+    // It is destroyed along with the last renderer, like the other graphics resources
+    static std::mutex             mutex;
+    static std::weak_ptr<Program> sharedProgram;
+
+    std::scoped_lock lock(mutex);
+
+    std::shared_ptr<Program> program = sharedProgram.lock();
+    if (!program)
+    {
+        program       = std::make_shared<Program>();
+        sharedProgram = program;
+    }
+
+    return program;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setAttributeBuffer(unsigned int buffer)
+{
+    if (buffer == m_attributeBuffer)
+        return;
+
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+    glCheck(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+    glCheck(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+    glCheck(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+    m_attributeBuffer = buffer;
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+bool CoreRenderer::isCoreProfile()
+{
+    // OpenGL ES has no core profile
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderer::CoreRenderer() = default;
+
+
+////////////////////////////////////////////////////////////
+CoreRenderer::~CoreRenderer() = default;
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::bind()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::useProgram(unsigned int /* program */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setProjection(const float* /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setModelView(const float* /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setTextureMatrix(const float* /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CoreRenderer::streamVertices(const Vertex* /* vertices */, std::size_t /* vertexCount */)
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::bindVertexBuffer(unsigned int /* buffer */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::streamIndices(const std::uint32_t* /* indices */, std::size_t /* indexCount */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::bindIndexBuffer(unsigned int /* buffer */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::applyUniforms()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setAttributeBuffer(unsigned int /* buffer */)
+{
+}
+
+#endif // SFML_OPENGL_ES
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/VertexStream.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+
+namespace sf
+{
+class Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Rendering backend of sf::RenderTarget for OpenGL 3.3 core profile contexts
+///
+/// Core profile contexts have no fixed-function pipeline and
+/// no client-side vertex arrays. This class provides their
+/// replacement: a built-in shader program taking the view,
+/// transform and texture matrices as uniforms, a vertex array
+/// object per context, and streaming buffers that receive
+/// the vertices and indices of immediate-mode draws.
+///
+/// The built-in program is compiled once and shared by all
+/// the renderers, since all SFML contexts share their objects.
+///
+////////////////////////////////////////////////////////////
+class CoreRenderer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the active context is a core profile context
+    ///
+    /// \return True if the active context is a 3.3 or later core profile context
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isCoreProfile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Compiles the built-in program if no other renderer
+    /// exists, a context must be active.
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreRenderer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CoreRenderer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreRenderer(const CoreRenderer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreRenderer& operator=(const CoreRenderer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the built-in program and the vertex array object of the active context
+    ///
+    ////////////////////////////////////////////////////////////
+    void bind();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Use a shader program
+    ///
+    /// The program must already be bound (sf::Shader::bind),
+    /// the sf_ uniforms are uploaded to it before each draw.
+    ///
+    /// \param program Native handle of the program, 0 to use the built-in program
+    ///
+    ////////////////////////////////////////////////////////////
+    void useProgram(unsigned int program);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the projection matrix (the view)
+    ///
+    /// \param matrix 4x4 matrix, in OpenGL order
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProjection(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the model-view matrix (the transform)
+    ///
+    /// \param matrix 4x4 matrix, in OpenGL order
+    ///
+    ////////////////////////////////////////////////////////////
+    void setModelView(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture matrix
+    ///
+    /// \param matrix 4x4 matrix in OpenGL order, or null to draw untextured
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureMatrix(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy vertices to the streaming buffer and source the attributes from it
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    ///
+    /// \return Index of the first copied vertex in the streaming buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t streamVertices(const Vertex* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Source the attributes from a vertex buffer
+    ///
+    /// \param buffer Native handle of the vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindVertexBuffer(unsigned int buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy indices to the streaming index buffer and source the indices from it
+    ///
+    /// The indices are read from the start of the buffer by
+    /// the next indexed draw.
+    ///
+    /// \param indices    Pointer to the indices
+    /// \param indexCount Number of indices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void streamIndices(const std::uint32_t* indices, std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Source the indices from an index buffer
+    ///
+    /// \param buffer Native handle of the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindIndexBuffer(unsigned int buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the modified uniforms to the program in use
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyUniforms();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Point the vertex attributes to a buffer, if not already done
+    ///
+    /// \param buffer Buffer to source the attributes from
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAttributeBuffer(unsigned int buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Uniform locations of a program
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Locations
+    {
+        int projection{-1};    //!< Location of sf_projection
+        int modelView{-1};     //!< Location of sf_modelView
+        int textureMatrix{-1}; //!< Location of sf_textureMatrix
+        int textured{-1};      //!< Location of sf_textured
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Built-in program, shared by all renderers
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Program;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the built-in program, compile it if no renderer uses it yet
+    ///
+    /// \return Shared built-in program
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::shared_ptr<Program> getProgram();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<Program>                        m_program;            //!< Built-in shader program
+    unsigned int                                    m_userProgram{0};     //!< Program of the sf::Shader in use, if any
+    std::unordered_map<std::uint64_t, unsigned int> m_vertexArrays;       //!< Vertex array objects, by context
+    unsigned int                                    m_attributeBuffer{0}; //!< Buffer the attributes currently point to
+    VertexStream                                    m_stream;             //!< Buffer receiving immediate-mode vertices
+    unsigned int                                    m_indexBuffer{0};     //!< Buffer receiving immediate-mode indices
+    std::array<float, 16>                           m_projection{};       //!< Current projection matrix
+    std::array<float, 16>                           m_modelView{};        //!< Current model-view matrix
+    std::array<float, 16>                           m_textureMatrix{};    //!< Current texture matrix
+    bool                                            m_textured{false};    //!< Is a texture bound?
+    unsigned int                                    m_dirtyUniforms{0xF}; //!< Built-in uniforms to upload (bit mask)
+};
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CullingGrid.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CullingGridImpl
+{
+// Scratch buffer for the handles found by a query, kept to avoid reallocating it every frame
+thread_local std::vector<std::size_t> handleScratch;
+
+// Cells are identified by their column and row packed in a single key
+std::uint64_t cellKey(int x, int y)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+}
+
+int cellColumn(std::uint64_t key)
+{
+    return static_cast<int>(static_cast<std::uint32_t>(key >> 32));
+}
+
+int cellRow(std::uint64_t key)
+{
+    return static_cast<int>(static_cast<std::uint32_t>(key & 0xFFFFFFFF));
+}
+
+int toCell(float coordinate)
+{
+    // Clamp before converting, so that huge or infinite coordinates don't overflow
+    const float limit = 1 << 30;
+    return static_cast<int>(std::floor(std::clamp(coordinate, -limit, limit)));
+}
+} // namespace CullingGridImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CullingGrid::CullingGrid(float cellSize) : m_cellSize(cellSize)
+{
+    assert(cellSize > 0.f && "Cell size must be strictly positive");
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CullingGrid::insert(const Drawable& drawable, const FloatRect& bounds)
+{
+    std::size_t handle = m_items.size();
+
+    if (m_freeHandles.empty())
+    {
+        m_items.emplace_back();
+    }
+    else
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+
+    Item& item    = m_items[handle];
+    item.drawable = &drawable;
+    item.bounds   = bounds;
+    item.cells    = computeCellRange(bounds);
+
+    link(handle, item.cells, true);
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::update(std::size_t handle, const FloatRect& bounds)
+{
+    assert(handle < m_items.size() && m_items[handle].drawable && "Invalid handle");
+
+    Item&           item  = m_items[handle];
+    const CellRange cells = computeCellRange(bounds);
+
+    // Only touch the cells if the drawable moved to other ones
+    if ((cells.left != item.cells.left) || (cells.top != item.cells.top) || (cells.right != item.cells.right) ||
+        (cells.bottom != item.cells.bottom))
+    {
+        link(handle, item.cells, false);
+        link(handle, cells, true);
+        item.cells = cells;
+    }
+
+    item.bounds = bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::remove(std::size_t handle)
+{
+    assert(handle < m_items.size() && m_items[handle].drawable && "Invalid handle");
+
+    link(handle, m_items[handle].cells, false);
+    m_items[handle].drawable = nullptr;
+    m_freeHandles.push_back(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::clear()
+{
+    m_items.clear();
+    m_freeHandles.clear();
+    m_cells.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CullingGrid::getDrawableCount() const
+{
+    return m_items.size() - m_freeHandles.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::query(const FloatRect& area, std::vector<const Drawable*>& drawables) const
+{
+    std::vector<std::size_t>& handles = CullingGridImpl::handleScratch;
+    collect(area, handles);
+
+    drawables.clear();
+    for (const std::size_t handle : handles)
+        drawables.push_back(m_items[handle].drawable);
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::query(const View& view, std::vector<const Drawable*>& drawables) const
+{
+    query(computeVisibleArea(view), drawables);
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect CullingGrid::computeVisibleArea(const View& view)
+{
+    // The view transform maps the visible area to the [-1, 1] square of normalized device coordinates
+    return view.getInverseTransform().transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::draw(RenderTarget& target, const RenderStates& states) const
+{
+    const FloatRect area = states.transform.getInverse().transformRect(computeVisibleArea(target.getView()));
+
+    // Take the scratch buffer for the duration of the draw calls: a drawable of the grid
+    // may be another grid, which would otherwise overwrite the handles being iterated
+    std::vector<std::size_t> handles = std::move(CullingGridImpl::handleScratch);
+    collect(area, handles);
+
+    for (const std::size_t handle : handles)
+        target.draw(*m_items[handle].drawable, states);
+
+    CullingGridImpl::handleScratch = std::move(handles);
+}
+
+
+////////////////////////////////////////////////////////////
+CullingGrid::CellRange CullingGrid::computeCellRange(const FloatRect& rectangle) const
+{
+    const float left   = std::min(rectangle.left, rectangle.left + rectangle.width);
+    const float top    = std::min(rectangle.top, rectangle.top + rectangle.height);
+    const float right  = std::max(rectangle.left, rectangle.left + rectangle.width);
+    const float bottom = std::max(rectangle.top, rectangle.top + rectangle.height);
+
+    return {CullingGridImpl::toCell(left / m_cellSize),
+            CullingGridImpl::toCell(top / m_cellSize),
+            CullingGridImpl::toCell(right / m_cellSize),
+            CullingGridImpl::toCell(bottom / m_cellSize)};
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::link(std::size_t handle, const CellRange& range, bool add)
+{
+    for (int y = range.top; y <= range.bottom; ++y)
+    {
+        for (int x = range.left; x <= range.right; ++x)
+        {
+            const std::uint64_t key = CullingGridImpl::cellKey(x, y);
+
+            if (add)
+            {
+                m_cells[key].push_back(handle);
+            }
+            else
+            {
+                const auto it = m_cells.find(key);
+                assert(it != m_cells.end() && "Drawable is missing from its cells");
+
+                // The order within a cell doesn't matter, the handles are sorted by queries
+                std::vector<std::size_t>& cell = it->second;
+                *std::find(cell.begin(), cell.end(), handle) = cell.back();
+                cell.pop_back();
+
+                if (cell.empty())
+                    m_cells.erase(it);
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CullingGrid::collect(const FloatRect& area, std::vector<std::size_t>& handles) const
+{
+    handles.clear();
+
+    if (m_cells.empty())
+        return;
+
+    const CellRange     range     = computeCellRange(area);
+    const std::uint64_t cellCount = static_cast<std::uint64_t>(range.right - range.left + 1) *
+                                    static_cast<std::uint64_t>(range.bottom - range.top + 1);
+
+    // Visit whichever is smaller: the cells covered by the area, or the non-empty cells
+    if (cellCount <= m_cells.size())
+    {
+        for (int y = range.top; y <= range.bottom; ++y)
+        {
+            for (int x = range.left; x <= range.right; ++x)
+            {
+                const auto it = m_cells.find(CullingGridImpl::cellKey(x, y));
+                if (it != m_cells.end())
+                    handles.insert(handles.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+    else
+    {
+        for (const auto& [key, cell] : m_cells)
+        {
+            const int x = CullingGridImpl::cellColumn(key);
+            const int y = CullingGridImpl::cellRow(key);
+
+            if ((x >= range.left) && (x <= range.right) && (y >= range.top) && (y <= range.bottom))
+                handles.insert(handles.end(), cell.begin(), cell.end());
+        }
+    }
+
+    // Drawables spanning several cells are found several times
+    std::sort(handles.begin(), handles.end());
+    handles.erase(std::unique(handles.begin(), handles.end()), handles.end());
+
+    // Cells are coarse, keep only the drawables that really intersect the area
+    handles.erase(std::remove_if(handles.begin(),
+                                 handles.end(),
+                                 [&](std::size_t handle) { return !m_items[handle].bounds.findIntersection(area); }),
+                  handles.end());
+}
+
+} // namespace sf
@@ -33,6 +33,7 @@
 #endif
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/Trace.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <ft2build.h>
@@ -548,6 +549,8 @@ Font::Page& Font::loadPage(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
+    SFML_TRACE_ZONE("Font::loadGlyph");
+
     // The glyph to return
     Glyph glyph;
 
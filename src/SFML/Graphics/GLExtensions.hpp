@@ -53,16 +53,17 @@
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object true
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
+#define GLEXT_vertex_buffer_object    true
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -147,6 +148,18 @@
 #define GLEXT_GL_MIN       GL_MIN_EXT
 #define GLEXT_GL_MAX       GL_MAX_EXT
 
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object false
+
+// Core since 3.0 - APPLE_sync
+#define GLEXT_sync false
+
+// Core since 3.2 - EXT_buffer_storage
+#define GLEXT_buffer_storage false
+
+// Core since 3.0 - EXT_disjoint_timer_query
+#define GLEXT_timer_query false
+
 #else
 
 // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -192,6 +205,7 @@
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object                SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                     GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER             GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                     GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                        GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                      GL_STATIC_DRAW_ARB
@@ -258,6 +272,12 @@
 #define GLEXT_blend_equation_separate             SF_GLAD_GL_EXT_blend_equation_separate
 #define GLEXT_glBlendEquationSeparate             glBlendEquationSeparateEXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+#define GLEXT_pixel_buffer_object                 SF_GLAD_GL_VERSION_2_1
+#define GLEXT_GL_PIXEL_PACK_BUFFER                GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER              GL_PIXEL_UNPACK_BUFFER
+#define GLEXT_GL_STREAM_READ                      GL_STREAM_READ
+
 // Core since 2.1 - EXT_texture_sRGB
 #define GLEXT_texture_sRGB                        SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                     GL_SRGB8_ALPHA8_EXT
@@ -301,6 +321,12 @@
 #define GLEXT_glRenderbufferStorageMultisample    glRenderbufferStorageMultisampleEXT
 #define GLEXT_GL_MAX_SAMPLES                      GL_MAX_SAMPLES_EXT
 
+// Core since 3.0 - ARB_vertex_array_object
+#define GLEXT_vertex_array_object                 SF_GLAD_GL_ARB_vertex_array_object
+#define GLEXT_glBindVertexArray                   glBindVertexArray
+#define GLEXT_glDeleteVertexArrays                glDeleteVertexArrays
+#define GLEXT_glGenVertexArrays                   glGenVertexArrays
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer                         SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER                 GL_COPY_READ_BUFFER
@@ -311,6 +337,38 @@
 #define GLEXT_geometry_shader4                    SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER                  GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                                SF_GLAD_GL_ARB_sync
+#define GLEXT_glFenceSync                         glFenceSync
+#define GLEXT_glClientWaitSync                    glClientWaitSync
+#define GLEXT_glDeleteSync                        glDeleteSync
+#define GLEXT_GLsync                              GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE       GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT          GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_TIMEOUT_EXPIRED                  GL_TIMEOUT_EXPIRED
+#define GLEXT_GL_WAIT_FAILED                      GL_WAIT_FAILED
+#define GLEXT_GL_TIMEOUT_IGNORED                  GL_TIMEOUT_IGNORED
+
+// Core since 3.3 - ARB_timer_query
+#define GLEXT_timer_query                         SF_GLAD_GL_ARB_timer_query
+#define GLEXT_glGenQueries                        glGenQueries
+#define GLEXT_glDeleteQueries                     glDeleteQueries
+#define GLEXT_glBeginQuery                        glBeginQuery
+#define GLEXT_glEndQuery                          glEndQuery
+#define GLEXT_glGetQueryObjectiv                  glGetQueryObjectiv
+#define GLEXT_glGetQueryObjectui64v               glGetQueryObjectui64v
+#define GLEXT_GL_TIME_ELAPSED                     GL_TIME_ELAPSED
+#define GLEXT_GL_QUERY_RESULT                     GL_QUERY_RESULT
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE           GL_QUERY_RESULT_AVAILABLE
+
+// Core since 4.4 - ARB_buffer_storage
+#define GLEXT_buffer_storage                      SF_GLAD_GL_ARB_buffer_storage
+#define GLEXT_glBufferStorage                     glBufferStorage
+#define GLEXT_glMapBufferRange                    glMapBufferRange
+#define GLEXT_GL_MAP_WRITE_BIT                    GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_PERSISTENT_BIT               GL_MAP_PERSISTENT_BIT
+#define GLEXT_GL_MAP_COHERENT_BIT                 GL_MAP_COHERENT_BIT
+
 #endif
 
 // OpenGL Versions
@@ -29,6 +29,7 @@
 #include <SFML/Graphics/Glsl.hpp>
 
 #include <algorithm>
+#include <array>
 
 
 namespace sf
@@ -39,8 +40,8 @@ namespace priv
 ////////////////////////////////////////////////////////////
 void copyMatrix(const Transform& source, Matrix<3, 3>& dest)
 {
-    const float* from = source.getMatrix(); // 4x4
-    float*       to   = dest.array;         // 3x3
+    const std::array<float, 16> from = source.getMatrix(); // 4x4
+    float*                      to   = dest.array;         // 3x3
 
     // Use only left-upper 3x3 block (for a 2D transform)
     to[0] = from[0];
@@ -59,7 +60,7 @@ void copyMatrix(const Transform& source, Matrix<3, 3>& dest)
 void copyMatrix(const Transform& source, Matrix<4, 4>& dest)
 {
     // Adopt 4x4 matrix as-is
-    copyMatrix(source.getMatrix(), 4 * 4, dest.array);
+    copyMatrix(source.getMatrix().data(), 4 * 4, dest.array);
 }
 
 
@@ -28,6 +28,7 @@
 #include <SFML/Graphics/ImageLoader.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/Trace.hpp>
 #include <SFML/System/Utils.hpp>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -91,6 +92,8 @@ ImageLoader::ImageLoader() = default;
 ////////////////////////////////////////////////////////////
 bool ImageLoader::loadImageFromFile(const std::filesystem::path& filename, std::vector<std::uint8_t>& pixels, Vector2u& size)
 {
+    SFML_TRACE_ZONE("ImageLoader::loadImageFromFile");
+
     // Clear the array (just in case)
     pixels.clear();
 
@@ -132,6 +135,8 @@ bool ImageLoader::loadImageFromFile(const std::filesystem::path& filename, std::
 ////////////////////////////////////////////////////////////
 bool ImageLoader::loadImageFromMemory(const void* data, std::size_t dataSize, std::vector<std::uint8_t>& pixels, Vector2u& size)
 {
+    SFML_TRACE_ZONE("ImageLoader::loadImageFromMemory");
+
     // Check input parameters
     if (data && dataSize)
     {
@@ -182,6 +187,8 @@ bool ImageLoader::loadImageFromMemory(const void* data, std::size_t dataSize, st
 ////////////////////////////////////////////////////////////
 bool ImageLoader::loadImageFromStream(InputStream& stream, std::vector<std::uint8_t>& pixels, Vector2u& size)
 {
+    SFML_TRACE_ZONE("ImageLoader::loadImageFromStream");
+
     // Clear the array (just in case)
     pixels.clear();
 
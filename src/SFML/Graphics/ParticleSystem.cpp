@@ -0,0 +1,473 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_PARTICLESYSTEM_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SFML_PARTICLESYSTEM_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ParticleSystemImpl
+{
+// Below this number of particles per thread, starting threads costs more than it saves
+constexpr std::size_t minParticlesPerThread = 4096;
+
+// Semi-implicit Euler integration: velocities are updated first, then positions with the new velocities
+void integrate(sf::Vector2f* positions,
+               sf::Vector2f* velocities,
+               std::size_t   count,
+               sf::Vector2f  acceleration,
+               float         seconds)
+{
+    // Positions and velocities are arrays of interleaved (x, y) floats, processed as flat float arrays
+    float*            position = &positions[0].x;
+    float*            velocity = &velocities[0].x;
+    const std::size_t size     = count * 2;
+    std::size_t       i        = 0;
+
+#if defined(SFML_PARTICLESYSTEM_SSE2)
+
+    const __m128 deltaVelocity = _mm_setr_ps(acceleration.x * seconds,
+                                             acceleration.y * seconds,
+                                             acceleration.x * seconds,
+                                             acceleration.y * seconds);
+    const __m128 deltaTime     = _mm_set1_ps(seconds);
+
+    for (; i + 3 < size; i += 4)
+    {
+        const __m128 newVelocity = _mm_add_ps(_mm_loadu_ps(velocity + i), deltaVelocity);
+        _mm_storeu_ps(velocity + i, newVelocity);
+        _mm_storeu_ps(position + i, _mm_add_ps(_mm_loadu_ps(position + i), _mm_mul_ps(newVelocity, deltaTime)));
+    }
+
+#elif defined(SFML_PARTICLESYSTEM_NEON)
+
+    const float       deltaVelocityData[] = {acceleration.x * seconds,
+                                             acceleration.y * seconds,
+                                             acceleration.x * seconds,
+                                             acceleration.y * seconds};
+    const float32x4_t deltaVelocity       = vld1q_f32(deltaVelocityData);
+
+    for (; i + 3 < size; i += 4)
+    {
+        const float32x4_t newVelocity = vaddq_f32(vld1q_f32(velocity + i), deltaVelocity);
+        vst1q_f32(velocity + i, newVelocity);
+        vst1q_f32(position + i, vmlaq_n_f32(vld1q_f32(position + i), newVelocity, seconds));
+    }
+
+#endif
+
+    // Remaining particle, or all of them without SIMD
+    for (; i < size; i += 2)
+    {
+        velocity[i] += acceleration.x * seconds;
+        velocity[i + 1] += acceleration.y * seconds;
+        position[i] += velocity[i] * seconds;
+        position[i + 1] += velocity[i + 1] * seconds;
+    }
+}
+
+// Decrease the remaining lives of the particles
+void age(float* remainingLives, std::size_t count, float seconds)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_PARTICLESYSTEM_SSE2)
+
+    const __m128 deltaTime = _mm_set1_ps(seconds);
+
+    for (; i + 3 < count; i += 4)
+        _mm_storeu_ps(remainingLives + i, _mm_sub_ps(_mm_loadu_ps(remainingLives + i), deltaTime));
+
+#elif defined(SFML_PARTICLESYSTEM_NEON)
+
+    const float32x4_t deltaTime = vdupq_n_f32(seconds);
+
+    for (; i + 3 < count; i += 4)
+        vst1q_f32(remainingLives + i, vsubq_f32(vld1q_f32(remainingLives + i), deltaTime));
+
+#endif
+
+    for (; i < count; ++i)
+        remainingLives[i] -= seconds;
+}
+} // namespace ParticleSystemImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(std::size_t capacity) :
+m_positions(capacity),
+m_velocities(capacity),
+m_remainingLives(capacity),
+m_lifetimes(capacity),
+m_colors(capacity),
+m_sizes(capacity),
+m_vertices(capacity * 4),
+m_vertexBuffer(PrimitiveType::Triangles, VertexBuffer::Stream),
+m_indexBuffer(IndexBuffer::Static)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::emit(const Vector2f& position,
+                          const Vector2f& velocity,
+                          Time            lifetime,
+                          const Color&    color,
+                          float           size)
+{
+    if (m_count == m_positions.size())
+        return false;
+
+    m_positions[m_count]      = position;
+    m_velocities[m_count]     = velocity;
+    m_remainingLives[m_count] = lifetime.asSeconds();
+    m_lifetimes[m_count]      = lifetime.asSeconds();
+    m_colors[m_count]         = color;
+    m_sizes[m_count]          = size;
+
+    // The particle can be drawn before the next update
+    updateQuad(m_count, color);
+    ++m_count;
+
+    m_needUpload = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time elapsed, unsigned int threadCount)
+{
+    const float       seconds    = elapsed.asSeconds();
+    const std::size_t blockCount = std::clamp<std::size_t>(m_count / ParticleSystemImpl::minParticlesPerThread,
+                                                           1,
+                                                           std::max(threadCount, 1u));
+
+    if (blockCount == 1)
+    {
+        m_count = updateBlock(0, m_count, seconds);
+    }
+    else
+    {
+        // Update the blocks in parallel, the calling thread takes the first one
+        const std::size_t        blockSize = (m_count + blockCount - 1) / blockCount;
+        std::vector<std::size_t> survivors(blockCount);
+        std::vector<std::thread> threads;
+        threads.reserve(blockCount - 1);
+
+        for (std::size_t block = 1; block < blockCount; ++block)
+        {
+            const std::size_t first = block * blockSize;
+            const std::size_t count = std::min(blockSize, m_count - first);
+
+            threads.emplace_back([this, &survivors, block, first, count, seconds]
+                                 { survivors[block] = updateBlock(first, count, seconds); });
+        }
+
+        survivors[0] = updateBlock(0, blockSize, seconds);
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        // Close the gaps left by the dead particles at the end of each block
+        std::size_t count = survivors[0];
+        for (std::size_t block = 1; block < blockCount; ++block)
+        {
+            moveParticles(block * blockSize, count, survivors[block]);
+            count += survivors[block];
+        }
+
+        m_count = count;
+    }
+
+    m_needUpload = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::clear()
+{
+    m_count      = 0;
+    m_needUpload = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vertex* ParticleSystem::getVertices() const
+{
+    return m_vertices.data();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getCapacity() const
+{
+    return m_positions.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAcceleration(const Vector2f& acceleration)
+{
+    m_acceleration = acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& ParticleSystem::getAcceleration() const
+{
+    return m_acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setFadeColor(const Color& color)
+{
+    m_fadeColor = color;
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& ParticleSystem::getFadeColor() const
+{
+    return m_fadeColor;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTexture(const Texture* texture, bool resetRect)
+{
+    if (texture)
+    {
+        // Recompute the texture area if requested, or if there was no texture & rect before
+        if (resetRect || (!m_texture && (m_textureRect == IntRect())))
+            setTextureRect(IntRect({0, 0}, Vector2i(texture->getSize())));
+    }
+
+    // Assign the new texture
+    m_texture = texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* ParticleSystem::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTextureRect(const IntRect& rect)
+{
+    m_textureRect = rect;
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& ParticleSystem::getTextureRect() const
+{
+    return m_textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, const RenderStates& states) const
+{
+    if (m_count == 0)
+        return;
+
+    // All the particles share the same indices: two triangles per quad of 4 vertices
+    if (m_indices.empty())
+    {
+        m_indices.reserve(getCapacity() * 6);
+
+        for (std::uint32_t i = 0; i < getCapacity(); ++i)
+        {
+            const std::uint32_t base = i * 4;
+            m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base + 2, base + 1, base + 3});
+        }
+    }
+
+    RenderStates statesCopy(states);
+
+    statesCopy.transform *= getTransform();
+    statesCopy.texture = m_texture;
+
+    // Recorded draws only reference the buffers, which are updated before they get executed.
+    // They can also be recorded on a thread without an OpenGL context (sf::RenderCommandBuffer)
+    if (target.getRenderQueue() || !VertexBuffer::isAvailable() || !IndexBuffer::isAvailable())
+    {
+        target.draw(m_vertices.data(),
+                    m_count * 4,
+                    m_indices.data(),
+                    m_count * 6,
+                    PrimitiveType::Triangles,
+                    statesCopy);
+        return;
+    }
+
+    if (m_indexBuffer.getIndexCount() == 0)
+    {
+        if (!m_indexBuffer.create(m_indices.size()) || !m_indexBuffer.update(m_indices.data()) ||
+            !m_vertexBuffer.create(m_vertices.size()))
+        {
+            err() << "Failed to create the buffers of the particle system" << std::endl;
+            return;
+        }
+    }
+
+    // Only the vertices of the living particles are streamed, once per update
+    if (m_needUpload)
+    {
+        if (!m_vertexBuffer.update(m_vertices.data(), m_count * 4, 0))
+        {
+            err() << "Failed to update the vertex buffer of the particle system" << std::endl;
+            return;
+        }
+
+        m_needUpload = false;
+    }
+
+    target.draw(m_vertexBuffer, m_indexBuffer, 0, m_count * 6, statesCopy);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::updateBlock(std::size_t first, std::size_t count, float seconds)
+{
+    if (count == 0)
+        return 0;
+
+    ParticleSystemImpl::integrate(&m_positions[first], &m_velocities[first], count, m_acceleration, seconds);
+    ParticleSystemImpl::age(&m_remainingLives[first], count, seconds);
+
+    // Share of the birth color lost at the death of the particles, for each component
+    const float fadeR = 1.f - static_cast<float>(m_fadeColor.r) / 255.f;
+    const float fadeG = 1.f - static_cast<float>(m_fadeColor.g) / 255.f;
+    const float fadeB = 1.f - static_cast<float>(m_fadeColor.b) / 255.f;
+    const float fadeA = 1.f - static_cast<float>(m_fadeColor.a) / 255.f;
+
+    const auto modulate = [](std::uint8_t component, float factor)
+    { return static_cast<std::uint8_t>(static_cast<float>(component) * factor); };
+
+    // Move the survivors down and write their vertices, in a single pass
+    std::size_t alive = first;
+    for (std::size_t i = first; i < first + count; ++i)
+    {
+        if (m_remainingLives[i] <= 0.f)
+            continue;
+
+        if (alive != i)
+        {
+            m_positions[alive]      = m_positions[i];
+            m_velocities[alive]     = m_velocities[i];
+            m_remainingLives[alive] = m_remainingLives[i];
+            m_lifetimes[alive]      = m_lifetimes[i];
+            m_colors[alive]         = m_colors[i];
+            m_sizes[alive]          = m_sizes[i];
+        }
+
+        const float  age   = 1.f - m_remainingLives[alive] / m_lifetimes[alive];
+        const Color& birth = m_colors[alive];
+
+        updateQuad(alive,
+                   Color(modulate(birth.r, 1.f - age * fadeR),
+                         modulate(birth.g, 1.f - age * fadeG),
+                         modulate(birth.b, 1.f - age * fadeB),
+                         modulate(birth.a, 1.f - age * fadeA)));
+
+        ++alive;
+    }
+
+    return alive - first;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateQuad(std::size_t index, const Color& color)
+{
+    const float    left     = static_cast<float>(m_textureRect.left);
+    const float    top      = static_cast<float>(m_textureRect.top);
+    const float    right    = static_cast<float>(m_textureRect.left + m_textureRect.width);
+    const float    bottom   = static_cast<float>(m_textureRect.top + m_textureRect.height);
+    const Vector2f center   = m_positions[index];
+    const float    halfSize = m_sizes[index] / 2.f;
+    Vertex*        vertices = &m_vertices[index * 4];
+
+    // Same corners as sf::Sprite
+    vertices[0] = Vertex(center + Vector2f(-halfSize, -halfSize), color, Vector2f(left, top));
+    vertices[1] = Vertex(center + Vector2f(-halfSize, halfSize), color, Vector2f(left, bottom));
+    vertices[2] = Vertex(center + Vector2f(halfSize, -halfSize), color, Vector2f(right, top));
+    vertices[3] = Vertex(center + Vector2f(halfSize, halfSize), color, Vector2f(right, bottom));
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::moveParticles(std::size_t from, std::size_t to, std::size_t count)
+{
+    // The destination is always before the source, so a forward copy is safe even if they overlap
+    if (from == to)
+        return;
+
+    std::copy_n(&m_positions[from], count, &m_positions[to]);
+    std::copy_n(&m_velocities[from], count, &m_velocities[to]);
+    std::copy_n(&m_remainingLives[from], count, &m_remainingLives[to]);
+    std::copy_n(&m_lifetimes[from], count, &m_lifetimes[to]);
+    std::copy_n(&m_colors[from], count, &m_colors[to]);
+    std::copy_n(&m_sizes[from], count, &m_sizes[to]);
+    std::copy_n(&m_vertices[from * 4], count * 4, &m_vertices[to * 4]);
+}
+
+} // namespace sf
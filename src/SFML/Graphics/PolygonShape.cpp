@@ -0,0 +1,587 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PolygonShape.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Tessellator.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace PolygonShapeImpl
+{
+// Compute the bounding rectangle of a range of vertices
+sf::FloatRect computeBounds(const sf::Vertex* vertices, std::size_t vertexCount)
+{
+    float left   = vertices[0].position.x;
+    float top    = vertices[0].position.y;
+    float right  = vertices[0].position.x;
+    float bottom = vertices[0].position.y;
+
+    for (std::size_t i = 1; i < vertexCount; ++i)
+    {
+        const sf::Vector2f position = vertices[i].position;
+
+        left   = std::min(left, position.x);
+        right  = std::max(right, position.x);
+        top    = std::min(top, position.y);
+        bottom = std::max(bottom, position.y);
+    }
+
+    return sf::FloatRect({left, top}, {right - left, bottom - top});
+}
+
+// Append two triangles covering the quad (a, b, c, d), where (a, b) and (c, d) are opposite edges
+void addQuad(std::vector<std::uint32_t>& indices, std::size_t a, std::size_t b, std::size_t c, std::size_t d)
+{
+    const auto first = indices.size();
+    indices.resize(first + 6);
+
+    indices[first + 0] = static_cast<std::uint32_t>(a);
+    indices[first + 1] = static_cast<std::uint32_t>(b);
+    indices[first + 2] = static_cast<std::uint32_t>(c);
+    indices[first + 3] = static_cast<std::uint32_t>(c);
+    indices[first + 4] = static_cast<std::uint32_t>(b);
+    indices[first + 5] = static_cast<std::uint32_t>(d);
+}
+
+// Scratch buffers used while the geometry is updated
+thread_local std::vector<sf::Vector2f>        points;
+thread_local std::vector<std::size_t>         contourSizes;
+thread_local std::vector<sf::priv::RingPoint> ring;
+} // namespace PolygonShapeImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PolygonShape::PolygonShape(std::size_t pointCount)
+{
+    setPointCount(pointCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setPointCount(std::size_t count)
+{
+    m_points.resize(count);
+    m_fillNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getPointCount() const
+{
+    return m_points.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setPoint(std::size_t index, const Vector2f& point)
+{
+    assert(index < m_points.size() && "Index is out of bounds");
+    m_points[index]  = point;
+    m_fillNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f PolygonShape::getPoint(std::size_t index) const
+{
+    assert(index < m_points.size() && "Index is out of bounds");
+    return m_points[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::addHole(const std::vector<Vector2f>& points)
+{
+    m_holes.push_back(points);
+    m_fillNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getHoleCount() const
+{
+    return m_holes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Vector2f>& PolygonShape::getHole(std::size_t index) const
+{
+    assert(index < m_holes.size() && "Index is out of bounds");
+    return m_holes[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::clearHoles()
+{
+    m_holes.clear();
+    m_fillNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setTexture(const Texture* texture, bool resetRect)
+{
+    if (texture)
+    {
+        // Recompute the texture area if requested, or if there was no texture & rect before
+        if (resetRect || (!m_texture && (m_textureRect == IntRect())))
+            setTextureRect(IntRect({0, 0}, Vector2i(texture->getSize())));
+    }
+
+    // Assign the new texture
+    m_texture = texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* PolygonShape::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setTextureRect(const IntRect& rect)
+{
+    m_textureRect         = rect;
+    m_texCoordsNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& PolygonShape::getTextureRect() const
+{
+    return m_textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setFillColor(const Color& color)
+{
+    // Without outline, the fringe takes the color of the inside
+    m_fillColor               = color;
+    m_fillColorsNeedUpdate    = true;
+    m_outlineColorsNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& PolygonShape::getFillColor() const
+{
+    return m_fillColor;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setOutlineColor(const Color& color)
+{
+    m_outlineColor            = color;
+    m_outlineColorsNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& PolygonShape::getOutlineColor() const
+{
+    return m_outlineColor;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setOutlineThickness(float thickness)
+{
+    m_outlineThickness  = thickness;
+    m_outlineNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float PolygonShape::getOutlineThickness() const
+{
+    return m_outlineThickness;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setJoinStyle(JoinStyle style)
+{
+    m_joinStyle         = style;
+    m_outlineNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+PolygonShape::JoinStyle PolygonShape::getJoinStyle() const
+{
+    return m_joinStyle;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setMiterLimit(float limit)
+{
+    m_miterLimit        = std::max(limit, 1.f);
+    m_outlineNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float PolygonShape::getMiterLimit() const
+{
+    return m_miterLimit;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setSmoothing(float width)
+{
+    m_smoothing         = width;
+    m_outlineNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float PolygonShape::getSmoothing() const
+{
+    return m_smoothing;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getLocalBounds() const
+{
+    ensureGeometryUpdate();
+
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::draw(RenderTarget& target, const RenderStates& states) const
+{
+    ensureGeometryUpdate();
+
+    // Polygons with less than 3 points have no geometry
+    if (m_fillVertexCount == 0)
+        return;
+
+    RenderStates statesCopy(states);
+
+    statesCopy.transform *= getTransform();
+
+    const bool hasOutline = m_indices.size() > m_fillIndexCount;
+
+    // Without a texture, the inside, the outline and the fringe are rendered in a single draw call
+    if (!m_texture || !hasOutline)
+    {
+        statesCopy.texture = m_texture;
+        target.draw(m_vertices.data(),
+                    m_vertices.size(),
+                    m_indices.data(),
+                    m_indices.size(),
+                    PrimitiveType::Triangles,
+                    statesCopy);
+        return;
+    }
+
+    // Render the inside
+    statesCopy.texture = m_texture;
+    target.draw(m_vertices.data(),
+                m_fillVertexCount,
+                m_indices.data(),
+                m_fillIndexCount,
+                PrimitiveType::Triangles,
+                statesCopy);
+
+    // Render the outline and the fringe
+    statesCopy.texture = nullptr;
+    target.draw(m_vertices.data(),
+                m_vertices.size(),
+                m_indices.data() + m_fillIndexCount,
+                m_indices.size() - m_fillIndexCount,
+                PrimitiveType::Triangles,
+                statesCopy);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::ensureGeometryUpdate() const
+{
+    if (m_fillNeedUpdate)
+        updateFill();
+
+    // Polygons with less than 3 points have no geometry
+    if (m_fillVertexCount == 0)
+        return;
+
+    if (m_fillColorsNeedUpdate)
+        updateFillColors();
+
+    if (m_texCoordsNeedUpdate)
+        updateTexCoords();
+
+    if (m_outlineNeedUpdate)
+        updateOutline();
+
+    if (m_outlineColorsNeedUpdate)
+        updateOutlineColors();
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateFill() const
+{
+    m_fillNeedUpdate = false;
+
+    m_vertices.clear();
+    m_indices.clear();
+    m_fillVertexCount   = 0;
+    m_fillIndexCount    = 0;
+    m_fringeVertexStart = 0;
+    m_insideBounds      = FloatRect();
+    m_bounds            = FloatRect();
+
+    if (m_points.size() < 3)
+        return;
+
+    // Gather all the contours, the outer one first
+    std::vector<Vector2f>&    points       = PolygonShapeImpl::points;
+    std::vector<std::size_t>& contourSizes = PolygonShapeImpl::contourSizes;
+    points.assign(m_points.begin(), m_points.end());
+    contourSizes.assign(1, m_points.size());
+
+    for (const std::vector<Vector2f>& hole : m_holes)
+    {
+        points.insert(points.end(), hole.begin(), hole.end());
+        contourSizes.push_back(hole.size());
+    }
+
+    // Self-intersecting polygons are drawn anyway, with the triangles that could be found
+    priv::triangulatePolygon(points, contourSizes, m_indices);
+
+    m_vertices.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+        m_vertices[i].position = points[i];
+
+    m_fillVertexCount = m_vertices.size();
+    m_fillIndexCount  = m_indices.size();
+
+    // The holes are inside the outer contour, they don't change the bounding rectangle
+    m_insideBounds = PolygonShapeImpl::computeBounds(m_vertices.data(), m_points.size());
+
+    // Every attribute depends on the positions
+    m_fillColorsNeedUpdate    = true;
+    m_texCoordsNeedUpdate     = true;
+    m_outlineNeedUpdate       = true;
+    m_outlineColorsNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateFillColors() const
+{
+    m_fillColorsNeedUpdate = false;
+
+    for (std::size_t i = 0; i < m_fillVertexCount; ++i)
+        m_vertices[i].color = m_fillColor;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateTexCoords() const
+{
+    m_texCoordsNeedUpdate = false;
+
+    const FloatRect convertedTextureRect(m_textureRect);
+
+    for (std::size_t i = 0; i < m_fillVertexCount; ++i)
+    {
+        const Vector2f position = m_vertices[i].position;
+        const float xratio = m_insideBounds.width > 0 ? (position.x - m_insideBounds.left) / m_insideBounds.width : 0;
+        const float yratio = m_insideBounds.height > 0 ? (position.y - m_insideBounds.top) / m_insideBounds.height : 0;
+        m_vertices[i].texCoords.x = convertedTextureRect.left + convertedTextureRect.width * xratio;
+        m_vertices[i].texCoords.y = convertedTextureRect.top + convertedTextureRect.height * yratio;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateOutline() const
+{
+    m_outlineNeedUpdate = false;
+
+    // The triangles of the fill are kept, only the ones of the outline are rebuilt
+    m_vertices.resize(m_fillVertexCount);
+    m_indices.resize(m_fillIndexCount);
+
+    std::vector<priv::RingPoint>& ring = PolygonShapeImpl::ring;
+
+    // The outline goes first, the fringe must be drawn on top of it
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        const bool fringe = pass == 1;
+        if (fringe)
+            m_fringeVertexStart = m_vertices.size();
+
+        if ((fringe && (m_smoothing == 0.f)) || (!fringe && (m_outlineThickness == 0.f)))
+            continue;
+
+        std::size_t first = 0;
+        for (std::size_t contour = 0; contour <= m_holes.size(); ++contour)
+        {
+            // Copy the points of the contour, the vertices may be reallocated while the outline is added
+            const std::size_t      count     = (contour == 0) ? m_points.size() : m_holes[contour - 1].size();
+            std::vector<Vector2f>& positions = PolygonShapeImpl::points;
+            positions.resize(count);
+            for (std::size_t i = 0; i < count; ++i)
+                positions[i] = m_vertices[first + i].position;
+
+            first += count;
+
+            // Orient the extrusion away from the inside of the polygon: outwards for the outer contour,
+            // inwards for the holes
+            const float area = priv::computeSignedArea(positions.data(), count);
+            const float side = ((area > 0.f) != (contour > 0)) ? -1.f : 1.f;
+
+            if (!fringe)
+            {
+                const float width = side * m_outlineThickness;
+                priv::extrudeContour(positions.data(), count, width, m_joinStyle, m_miterLimit, ring);
+
+                // The inner vertices are copies of the contour points, the outer vertices follow the ring
+                const std::size_t inner = m_vertices.size();
+                const std::size_t outer = inner + count;
+                m_vertices.resize(outer + ring.size());
+
+                for (std::size_t i = 0; i < count; ++i)
+                    m_vertices[inner + i].position = positions[i];
+
+                for (std::size_t i = 0; i < ring.size(); ++i)
+                    m_vertices[outer + i].position = positions[ring[i].corner] + ring[i].offset;
+
+                // Consecutive ring points around the same corner form a join, the others span a segment
+                for (std::size_t i = 0; i < ring.size(); ++i)
+                {
+                    const std::size_t next = (i + 1) % ring.size();
+                    if (ring[i].corner == ring[next].corner)
+                    {
+                        m_indices.push_back(static_cast<std::uint32_t>(inner + ring[i].corner));
+                        m_indices.push_back(static_cast<std::uint32_t>(outer + i));
+                        m_indices.push_back(static_cast<std::uint32_t>(outer + next));
+                    }
+                    else
+                    {
+                        PolygonShapeImpl::addQuad(m_indices,
+                                                  inner + ring[i].corner,
+                                                  outer + i,
+                                                  inner + ring[next].corner,
+                                                  outer + next);
+                    }
+                }
+            }
+            else
+            {
+                // The fringe surrounds the silhouette: the outer edge of the outline if it grows outwards
+                // (the same ring, made longer), the contour itself otherwise
+                const bool  aroundOutline = m_outlineThickness > 0.f;
+                const float width         = aroundOutline ? m_outlineThickness : m_smoothing;
+                priv::extrudeContour(positions.data(), count, side * width, m_joinStyle, m_miterLimit, ring);
+
+                const float       scale = aroundOutline ? (m_outlineThickness + m_smoothing) / m_outlineThickness : 1.f;
+                const std::size_t start = m_vertices.size();
+                m_vertices.resize(start + ring.size() * 2);
+
+                // The fringe is a strip of (opaque, transparent) vertex pairs
+                for (std::size_t i = 0; i < ring.size(); ++i)
+                {
+                    const Vector2f position                = positions[ring[i].corner];
+                    m_vertices[start + i * 2].position     = aroundOutline ? position + ring[i].offset : position;
+                    m_vertices[start + i * 2 + 1].position = position + ring[i].offset * scale;
+                }
+
+                for (std::size_t i = 0; i < ring.size(); ++i)
+                {
+                    const std::size_t next = (i + 1) % ring.size();
+                    PolygonShapeImpl::addQuad(m_indices,
+                                              start + i * 2,
+                                              start + i * 2 + 1,
+                                              start + next * 2,
+                                              start + next * 2 + 1);
+                }
+            }
+        }
+    }
+
+    // The outline vertices may have been added back
+    m_outlineColorsNeedUpdate = true;
+
+    // Update the shape's bounds
+    m_bounds = PolygonShapeImpl::computeBounds(m_vertices.data(), m_vertices.size());
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateOutlineColors() const
+{
+    m_outlineColorsNeedUpdate = false;
+
+    for (std::size_t i = m_fillVertexCount; i < m_fringeVertexStart; ++i)
+        m_vertices[i].color = m_outlineColor;
+
+    // The fringe fades the silhouette out to transparent
+    const Color opaque      = (m_outlineThickness != 0.f) ? m_outlineColor : m_fillColor;
+    Color       transparent = opaque;
+    transparent.a           = 0;
+
+    for (std::size_t i = m_fringeVertexStart; i < m_vertices.size(); i += 2)
+    {
+        m_vertices[i].color     = opaque;
+        m_vertices[i + 1].color = transparent;
+    }
+}
+
+} // namespace sf
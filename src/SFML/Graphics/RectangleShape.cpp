@@ -42,6 +42,9 @@ RectangleShape::RectangleShape(const Vector2f& size)
 ////////////////////////////////////////////////////////////
 void RectangleShape::setSize(const Vector2f& size)
 {
+    if (size == m_size)
+        return;
+
     m_size = size;
     update();
 }
@@ -78,4 +81,14 @@ Vector2f RectangleShape::getPoint(std::size_t index) const
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void RectangleShape::getPoints(Vector2f* points) const
+{
+    points[0] = Vector2f(0, 0);
+    points[1] = Vector2f(m_size.x, 0);
+    points[2] = Vector2f(m_size.x, m_size.y);
+    points[3] = Vector2f(0, m_size.y);
+}
+
 } // namespace sf
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderCommandBuffer.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderCommandBuffer::RenderCommandBuffer(const Vector2u& size) : m_size(size)
+{
+    // Everything drawn to this target goes to the queue
+    setRenderQueue(&m_commands);
+
+    RenderTarget::initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u RenderCommandBuffer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderCommandBuffer::setActive(bool active)
+{
+    // There's no context to activate
+    return !active;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderQueue& RenderCommandBuffer::getQueue()
+{
+    return m_commands;
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderQueue& RenderCommandBuffer::getQueue() const
+{
+    return m_commands;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderCommandBuffer::reset()
+{
+    m_commands.clear();
+}
+
+} // namespace sf
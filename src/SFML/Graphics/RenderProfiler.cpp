@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/RenderProfiler.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+#include <SFML/Window/Context.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RenderProfilerImpl
+{
+std::recursive_mutex isAvailableMutex;
+
+// Texture uploads of the whole process, sampled by the profilers at the start and end of their frames
+std::atomic<std::uint64_t> textureUploads(0);
+std::atomic<std::uint64_t> uploadedBytes(0);
+
+// Maximum number of timer queries in flight, the oldest one is waited for beyond that
+constexpr std::size_t maxPendingQueries = 8;
+} // namespace RenderProfilerImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderProfiler::RenderProfiler(std::size_t historySize) : m_historySize(std::max<std::size_t>(historySize, 1))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderProfiler::~RenderProfiler()
+{
+#ifndef SFML_OPENGL_ES
+
+    if (!m_contextId)
+        return;
+
+    TransientContextLock lock;
+
+    // Query objects are not shared between contexts, they can only be destroyed in their own
+    if (Context::getActiveContextId() != m_contextId)
+        return;
+
+    for (const Query& query : m_pendingQueries)
+        glCheck(GLEXT_glDeleteQueries(1, &query.query));
+
+    if (m_activeQuery)
+        glCheck(GLEXT_glDeleteQueries(1, &m_activeQuery));
+
+    if (!m_freeQueries.empty())
+        glCheck(GLEXT_glDeleteQueries(static_cast<GLsizei>(m_freeQueries.size()), m_freeQueries.data()));
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderProfiler::beginFrame()
+{
+    // Restart the frame if the previous one was not ended
+    const std::uint64_t index = m_frames.empty() ? 0 : m_frames.back().index + 1;
+
+    m_current        = FrameStats();
+    m_current.index  = index;
+    m_current.start  = m_clock.getElapsedTime();
+    m_recording      = true;
+    m_uploadsAtStart = RenderProfilerImpl::textureUploads;
+    m_bytesAtStart   = RenderProfilerImpl::uploadedBytes;
+
+#ifndef SFML_OPENGL_ES
+
+    if (!isGpuTimingAvailable())
+        return;
+
+    // Timer queries belong to the context that created them
+    const std::uint64_t contextId = Context::getActiveContextId();
+    if (!contextId || (m_contextId && (contextId != m_contextId)))
+        return;
+
+    m_contextId = contextId;
+
+    // A query of the previous frame that was never ended is simply reused
+    if (!m_activeQuery)
+    {
+        if (m_freeQueries.empty())
+        {
+            glCheck(GLEXT_glGenQueries(1, &m_activeQuery));
+        }
+        else
+        {
+            m_activeQuery = m_freeQueries.back();
+            m_freeQueries.pop_back();
+        }
+    }
+    else
+    {
+        glCheck(GLEXT_glEndQuery(GLEXT_GL_TIME_ELAPSED));
+    }
+
+    glCheck(GLEXT_glBeginQuery(GLEXT_GL_TIME_ELAPSED, m_activeQuery));
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderProfiler::endFrame()
+{
+    if (!m_recording)
+        return;
+
+    m_current.cpuTime        = m_clock.getElapsedTime() - m_current.start;
+    m_current.textureUploads = static_cast<std::size_t>(RenderProfilerImpl::textureUploads - m_uploadsAtStart);
+    m_current.uploadedBytes  = static_cast<std::size_t>(RenderProfilerImpl::uploadedBytes - m_bytesAtStart);
+    m_recording              = false;
+
+    m_frames.push_back(m_current);
+    while (m_frames.size() > m_historySize)
+        m_frames.pop_front();
+
+#ifndef SFML_OPENGL_ES
+
+    if (m_activeQuery && (Context::getActiveContextId() == m_contextId))
+    {
+        glCheck(GLEXT_glEndQuery(GLEXT_GL_TIME_ELAPSED));
+
+        m_pendingQueries.push_back({m_activeQuery, m_current.index});
+        m_activeQuery = 0;
+
+        // Only block if the graphics card is really far behind
+        retrieveGpuTimes(m_pendingQueries.size() > RenderProfilerImpl::maxPendingQueries);
+    }
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderProfiler::getFrameCount() const
+{
+    return m_frames.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderProfiler::FrameStats& RenderProfiler::getFrame(std::size_t index) const
+{
+    assert(index < m_frames.size() && "Index is out of bounds");
+    return m_frames[index];
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderProfiler::saveChromeTrace(const std::filesystem::path& filename) const
+{
+    std::ofstream file(filename, std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to save Chrome trace\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Timestamps and durations are in microseconds
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << R"({"name":"thread_name","ph":"M","pid":1,"tid":1,"args":{"name":"CPU"}},)" << '\n';
+    file << R"({"name":"thread_name","ph":"M","pid":1,"tid":2,"args":{"name":"GPU"}})";
+
+    for (const FrameStats& frame : m_frames)
+    {
+        const std::int64_t start = frame.start.asMicroseconds();
+
+        file << ",\n{\"name\":\"Frame " << frame.index << R"(","cat":"frame","ph":"X","pid":1,"tid":1,"ts":)" << start
+             << ",\"dur\":" << frame.cpuTime.asMicroseconds() << ",\"args\":{\"drawCalls\":" << frame.drawCalls
+             << ",\"vertices\":" << frame.vertices << ",\"textureChanges\":" << frame.textureChanges
+             << ",\"blendModeChanges\":" << frame.blendModeChanges << ",\"shaderChanges\":" << frame.shaderChanges
+             << ",\"textureUploads\":" << frame.textureUploads << ",\"uploadedBytes\":" << frame.uploadedBytes << "}}";
+
+        if (frame.hasGpuTime)
+        {
+            file << ",\n{\"name\":\"Frame " << frame.index << R"(","cat":"gpu","ph":"X","pid":1,"tid":2,"ts":)"
+                 << start << ",\"dur\":" << frame.gpuTime.asMicroseconds() << '}';
+        }
+
+        // Counters are displayed as graphs above the tracks
+        file << ",\n{\"name\":\"Draw calls\",\"ph\":\"C\",\"pid\":1,\"ts\":" << start
+             << ",\"args\":{\"draws\":" << frame.drawCalls << ",\"state changes\":"
+             << frame.textureChanges + frame.blendModeChanges + frame.shaderChanges << "}}";
+    }
+
+    file << "\n]}\n";
+
+    if (!file)
+    {
+        err() << "Failed to save Chrome trace (write error)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderProfiler::isGpuTimingAvailable()
+{
+    std::scoped_lock lock(RenderProfilerImpl::isAvailableMutex);
+
+    static bool checked   = false;
+    static bool available = false;
+
+    if (!checked)
+    {
+        checked = true;
+
+        TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        available = GLEXT_timer_query;
+    }
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderProfiler::countTextureUpload(std::size_t bytes)
+{
+    ++RenderProfilerImpl::textureUploads;
+    RenderProfilerImpl::uploadedBytes += bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderProfiler::retrieveGpuTimes([[maybe_unused]] bool wait)
+{
+#ifndef SFML_OPENGL_ES
+
+    while (!m_pendingQueries.empty())
+    {
+        const Query query = m_pendingQueries.front();
+
+        // Results are available in the order the queries were issued
+        if (!wait)
+        {
+            GLint available = GL_FALSE;
+            glCheck(GLEXT_glGetQueryObjectiv(query.query, GLEXT_GL_QUERY_RESULT_AVAILABLE, &available));
+
+            if (available == GL_FALSE)
+                return;
+        }
+
+        GLuint64 elapsed = 0;
+        glCheck(GLEXT_glGetQueryObjectui64v(query.query, GLEXT_GL_QUERY_RESULT, &elapsed));
+
+        m_pendingQueries.pop_front();
+        m_freeQueries.push_back(query.query);
+        wait = false;
+
+        // The frame may already have left the history
+        const std::uint64_t oldest = m_frames.front().index;
+        if (query.frame >= oldest)
+        {
+            FrameStats& frame = m_frames[static_cast<std::size_t>(query.frame - oldest)];
+            frame.gpuTime     = microseconds(static_cast<std::int64_t>(elapsed / 1000));
+            frame.hasGpuTime  = true;
+        }
+    }
+
+#endif // SFML_OPENGL_ES
+}
+
+} // namespace sf
@@ -0,0 +1,403 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderQueue.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <numeric>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RenderQueueImpl
+{
+// Find an element in a small table, adding it if needed, and return its index
+template <typename T>
+std::uint64_t findOrInsert(std::vector<T>& table, const T& value)
+{
+    auto it = std::find(table.begin(), table.end(), value);
+    if (it == table.end())
+        it = table.insert(it, value);
+
+    return static_cast<std::uint64_t>(it - table.begin());
+}
+} // namespace RenderQueueImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void RenderQueue::setLayer(std::uint8_t layer)
+{
+    m_layer = layer;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t RenderQueue::getLayer() const
+{
+    return m_layer;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::setLayerOrdered(std::uint8_t layer, bool ordered)
+{
+    m_orderedLayers[layer] = ordered;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderQueue::isLayerOrdered(std::uint8_t layer) const
+{
+    return m_orderedLayers[layer];
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    const std::size_t firstVertex = m_vertices.size();
+
+    const auto append = [&](std::size_t index) { m_vertices.push_back(vertices[index]); };
+
+    // Convert strips and fans to lists, which can be concatenated
+    switch (type)
+    {
+        case PrimitiveType::LineStrip:
+            type = PrimitiveType::Lines;
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                append(i - 1);
+                append(i);
+            }
+            break;
+
+        case PrimitiveType::TriangleStrip:
+            type = PrimitiveType::Triangles;
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                // Every other triangle of a strip has its first two vertices swapped to keep the winding
+                append(i % 2 ? i - 1 : i - 2);
+                append(i % 2 ? i - 2 : i - 1);
+                append(i);
+            }
+            break;
+
+        case PrimitiveType::TriangleFan:
+            type = PrimitiveType::Triangles;
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(0);
+                append(i - 1);
+                append(i);
+            }
+            break;
+
+        default:
+            m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+            break;
+    }
+
+    // Strips and fans too short to form a primitive
+    if (m_vertices.size() == firstVertex)
+        return;
+
+    // Transform the vertices in a single batch, so that commands with different transforms can be merged
+    states.transform.transformPoints(m_vertices.data() + firstVertex,
+                                     m_vertices.size() - firstVertex,
+                                     m_vertices.data() + firstVertex);
+
+    RenderStates commandStates = states;
+    commandStates.transform    = Transform::Identity;
+
+    m_commands.push_back(
+        {makeKey(states, type), commandStates, type, firstVertex, m_vertices.size() - firstVertex, nullptr, nullptr});
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::draw(const Vertex*        vertices,
+                       std::size_t          vertexCount,
+                       const std::uint32_t* indices,
+                       std::size_t          indexCount,
+                       PrimitiveType        type,
+                       const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !indices || (indexCount == 0))
+        return;
+
+    // Merged commands are drawn without indices, expand the indexed vertices
+    m_batch.resize(indexCount);
+    for (std::size_t i = 0; i < indexCount; ++i)
+    {
+        assert(indices[i] < vertexCount);
+        m_batch[i] = vertices[indices[i]];
+    }
+
+    draw(m_batch.data(), m_batch.size(), type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::draw(const VertexBuffer& vertexBuffer,
+                       std::size_t         firstVertex,
+                       std::size_t         vertexCount,
+                       const RenderStates& states)
+{
+    const PrimitiveType type = vertexBuffer.getPrimitiveType();
+
+    m_commands.push_back({makeKey(states, type), states, type, firstVertex, vertexCount, &vertexBuffer, nullptr});
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::draw(const VertexBuffer& vertexBuffer,
+                       const IndexBuffer&  indexBuffer,
+                       std::size_t         firstIndex,
+                       std::size_t         indexCount,
+                       const RenderStates& states)
+{
+    const PrimitiveType type = vertexBuffer.getPrimitiveType();
+
+    m_commands.push_back({makeKey(states, type), states, type, firstIndex, indexCount, &vertexBuffer, &indexBuffer});
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::append(const RenderQueue& queue)
+{
+    // Appending a queue to itself would invalidate the commands while reading them
+    assert(&queue != this);
+
+    m_commands.reserve(m_commands.size() + queue.m_commands.size());
+    m_vertices.reserve(m_vertices.size() + queue.m_vertices.size());
+
+    const std::uint8_t currentLayer = m_layer;
+
+    for (const Command& command : queue.m_commands)
+    {
+        // Keys hold indices into the tables of their queue, they have to be computed again for this one
+        m_layer = static_cast<std::uint8_t>(command.key >> 56);
+
+        Command appended = command;
+        appended.key     = makeKey(command.states, command.type);
+
+        if (!command.vertexBuffer)
+        {
+            const auto first     = queue.m_vertices.begin() + static_cast<std::ptrdiff_t>(command.firstVertex);
+            appended.firstVertex = m_vertices.size();
+            m_vertices.insert(m_vertices.end(), first, first + static_cast<std::ptrdiff_t>(command.vertexCount));
+        }
+
+        m_commands.push_back(appended);
+    }
+
+    m_layer = currentLayer;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderQueue::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::clear()
+{
+    m_commands.clear();
+    m_vertices.clear();
+    m_shaders.clear();
+    m_textures.clear();
+    m_blendModes.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::flush(RenderTarget& target)
+{
+    // Make sure that the commands are drawn for real and not queued again.
+    // Draws redirected to another queue (such as a command buffer) are left as they are
+    RenderQueue* redirection = target.getRenderQueue();
+    if (redirection == this)
+        target.setRenderQueue(nullptr);
+
+    sortCommands();
+
+    for (std::size_t i = 0; i < m_order.size();)
+    {
+        const Command& command = m_commands[m_order[i]];
+
+        if (command.indexBuffer)
+        {
+            target.draw(*command.vertexBuffer,
+                        *command.indexBuffer,
+                        command.firstVertex,
+                        command.vertexCount,
+                        command.states);
+            ++i;
+            continue;
+        }
+
+        if (command.vertexBuffer)
+        {
+            target.draw(*command.vertexBuffer, command.firstVertex, command.vertexCount, command.states);
+            ++i;
+            continue;
+        }
+
+        // Find the following commands that can be drawn along with this one
+        std::size_t end = i + 1;
+        while (end < m_order.size())
+        {
+            const Command& next = m_commands[m_order[end]];
+            if (next.vertexBuffer || (next.type != command.type) || (next.states.texture != command.states.texture) ||
+                (next.states.shader != command.states.shader) || (next.states.blendMode != command.states.blendMode))
+                break;
+
+            ++end;
+        }
+
+        if (end == i + 1)
+        {
+            target.draw(m_vertices.data() + command.firstVertex, command.vertexCount, command.type, command.states);
+        }
+        else
+        {
+            // Concatenate the vertices of the merged commands
+            m_batch.clear();
+            for (std::size_t j = i; j < end; ++j)
+            {
+                const Command& merged = m_commands[m_order[j]];
+                const auto     first  = m_vertices.begin() + static_cast<std::ptrdiff_t>(merged.firstVertex);
+                m_batch.insert(m_batch.end(), first, first + static_cast<std::ptrdiff_t>(merged.vertexCount));
+            }
+
+            target.draw(m_batch.data(), m_batch.size(), command.type, command.states);
+        }
+
+        i = end;
+    }
+
+    if (redirection == this)
+        target.setRenderQueue(redirection);
+
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t RenderQueue::makeKey(const RenderStates& states, PrimitiveType type)
+{
+    // Key layout, from the most significant bits:
+    // layer (8) | shader (16) | texture (24) | blend mode (8) | primitive type (8)
+    // or, for ordered layers:
+    // layer (8) | submission index (56)
+    const std::uint64_t layer = static_cast<std::uint64_t>(m_layer) << 56;
+
+    if (m_orderedLayers[m_layer])
+        return layer | m_commands.size();
+
+    // Replace the states by dense indices, so that they fit in the key.
+    // Shaders and blend modes are few, a linear search is faster than hashing
+    const std::uint64_t shader    = RenderQueueImpl::findOrInsert(m_shaders, states.shader);
+    const std::uint64_t blendMode = RenderQueueImpl::findOrInsert(m_blendModes, states.blendMode);
+    std::uint64_t       texture   = 0;
+    if (states.texture)
+    {
+        const auto size = static_cast<std::uint32_t>(m_textures.size());
+        texture         = m_textures.try_emplace(states.texture->m_cacheId, size + 1).first->second;
+    }
+
+    // Indices that overflow their field only make the sort less effective, merging compares the actual states
+    return layer | ((shader & 0xFFFF) << 40) | ((texture & 0xFFFFFF) << 16) | ((blendMode & 0xFF) << 8) |
+           static_cast<std::uint64_t>(type);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::sortCommands()
+{
+    const std::size_t count = m_commands.size();
+
+    m_order.resize(count);
+    std::iota(m_order.begin(), m_order.end(), std::uint32_t{0});
+
+    if (count < 2)
+        return;
+
+    // Build the histograms of all the 8-bit digits in a single pass
+    std::array<std::array<std::uint32_t, 256>, 8> histograms{};
+    for (const Command& command : m_commands)
+    {
+        for (std::size_t digit = 0; digit < 8; ++digit)
+            ++histograms[digit][(command.key >> (digit * 8)) & 0xFF];
+    }
+
+    // Least significant digit first radix sort, which is stable
+    m_sortBuffer.resize(count);
+    for (std::size_t digit = 0; digit < 8; ++digit)
+    {
+        std::array<std::uint32_t, 256>& histogram = histograms[digit];
+        const std::size_t               shift     = digit * 8;
+
+        // Skip the pass if all keys share the same digit
+        if (histogram[(m_commands[0].key >> shift) & 0xFF] == count)
+            continue;
+
+        // Turn the counts into offsets
+        std::uint32_t offset = 0;
+        for (std::uint32_t& bucket : histogram)
+        {
+            const std::uint32_t size = bucket;
+            bucket                   = offset;
+            offset += size;
+        }
+
+        for (const std::uint32_t index : m_order)
+            m_sortBuffer[histogram[(m_commands[index].key >> shift) & 0xFF]++] = index;
+
+        m_order.swap(m_sortBuffer);
+    }
+}
+
+} // namespace sf
@@ -25,22 +25,30 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoreRenderer.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/RenderProfiler.hpp>
+#include <SFML/Graphics/RenderQueue.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/VertexStream.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/Window/Context.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <iostream>
+#include <limits>
 #include <mutex>
 #include <ostream>
 #include <unordered_map>
+#include <vector>
 
 
 namespace
@@ -67,15 +75,46 @@ std::uint64_t getUniqueId()
 using ContextRenderTargetMap = std::unordered_map<std::uint64_t, std::uint64_t>;
 ContextRenderTargetMap contextRenderTargetMap;
 
+// Incremented (with the mutex locked) whenever the map changes, so
+// that threads can tell whether their last lookup is still valid
+std::atomic<std::uint64_t> contextRenderTargetMapVersion(0);
+
+// Result of the last map lookup made by the current thread
+struct ActiveRenderTargetCache
+{
+    std::uint64_t version{std::numeric_limits<std::uint64_t>::max()}; //!< Map version at the time of the lookup
+    std::uint64_t contextId{0};                                       //!< Context that was looked up
+    std::uint64_t renderTargetId{0};                                  //!< RenderTarget active in this context
+};
+
+thread_local ActiveRenderTargetCache activeRenderTargetCache;
+
 // Check if a RenderTarget with the given ID is active in the current context
 bool isActive(std::uint64_t id)
 {
-    auto it = contextRenderTargetMap.find(sf::Context::getActiveContextId());
+    const std::uint64_t contextId = sf::Context::getActiveContextId();
 
-    if ((it == contextRenderTargetMap.end()) || (it->second != id))
-        return false;
+    // As long as the map didn't change, the last lookup of this thread is still valid
+    // and drawing doesn't have to contend for the mutex with the other threads
+    if ((activeRenderTargetCache.contextId == contextId) &&
+        (activeRenderTargetCache.version == contextRenderTargetMapVersion.load(std::memory_order_acquire)))
+        return activeRenderTargetCache.renderTargetId == id;
 
-    return true;
+    std::scoped_lock lock(mutex);
+
+    auto it = contextRenderTargetMap.find(contextId);
+
+    activeRenderTargetCache.version        = contextRenderTargetMapVersion.load(std::memory_order_relaxed);
+    activeRenderTargetCache.contextId      = contextId;
+    activeRenderTargetCache.renderTargetId = (it != contextRenderTargetMap.end()) ? it->second : 0;
+
+    return activeRenderTargetCache.renderTargetId == id;
+}
+
+// Record a change of the map, the mutex must be locked
+void mapChanged()
+{
+    contextRenderTargetMapVersion.fetch_add(1, std::memory_order_release);
 }
 
 // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
@@ -140,6 +179,30 @@ std::uint32_t equationToGlConstant(sf::BlendMode::Equation blendEquation)
 
     return GLEXT_GL_FUNC_ADD;
 }
+
+
+// Convert an sf::PrimitiveType to the corresponding OpenGL constant.
+GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[static_cast<std::size_t>(type)];
+}
+
+#ifdef SFML_OPENGL_ES
+
+// Expand indexed vertices into a scratch array, for targets that can't draw 32-bit indices
+const std::vector<sf::Vertex>& deindex(const sf::Vertex* vertices, const std::uint32_t* indices, std::size_t indexCount)
+{
+    thread_local std::vector<sf::Vertex> deindexed;
+
+    deindexed.resize(indexCount);
+    for (std::size_t i = 0; i < indexCount; ++i)
+        deindexed[i] = vertices[indices[i]];
+
+    return deindexed;
+}
+
+#endif // SFML_OPENGL_ES
 } // namespace RenderTargetImpl
 } // namespace
 
@@ -159,6 +222,10 @@ void RenderTarget::clear(const Color& color)
 {
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
+        // The backend must be selected before touching any texture state
+        if (!m_cache.glStatesSet && !m_coreRenderer && priv::CoreRenderer::isCoreProfile())
+            resetGLStates();
+
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
 
@@ -260,24 +327,125 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
+    // Deferred drawing?
+    if (m_queue)
+    {
+        m_queue->draw(vertices, vertexCount, type, states);
+        return;
+    }
+
+    drawVertices(vertices, vertexCount, nullptr, 0, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint32_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !indices || (indexCount == 0))
+        return;
+
+    // Deferred drawing?
+    if (m_queue)
+    {
+        m_queue->draw(vertices, vertexCount, indices, indexCount, type, states);
+        return;
+    }
+
+#ifdef SFML_OPENGL_ES
+
+    // OpenGL ES 1 has no 32-bit indices, draw the indexed vertices one after the other instead
+    const std::vector<Vertex>& deindexed = RenderTargetImpl::deindex(vertices, indices, indexCount);
+    drawVertices(deindexed.data(), deindexed.size(), nullptr, 0, type, states);
+
+#else
+
+    drawVertices(vertices, vertexCount, indices, indexCount, type, states);
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex*        vertices,
+                                std::size_t          vertexCount,
+                                const std::uint32_t* indices,
+                                std::size_t          indexCount,
+                                PrimitiveType        type,
+                                const RenderStates&  states)
+{
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Check if the vertex count is low enough so that we can pre-transform them
         bool useVertexCache = (vertexCount <= StatesCache::VertexCacheSize);
 
+        // Pre-transform the vertices and store them into the vertex cache
         if (useVertexCache)
+            states.transform.transformPoints(vertices, vertexCount, m_cache.vertexCache);
+
+        setupDraw(useVertexCache, states);
+
+        // Core profile: stream the vertices to the GPU, there are no client-side arrays
+        if (m_coreRenderer)
         {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
+            const std::size_t first = m_coreRenderer->streamVertices(useVertexCache ? m_cache.vertexCache : vertices,
+                                                                     vertexCount);
+
+            if (indices)
+            {
+                m_coreRenderer->streamIndices(indices, indexCount);
+                drawIndexedPrimitives(type, nullptr, indexCount, first);
+            }
+            else
             {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
+                drawPrimitives(type, first, vertexCount);
             }
+
+            cleanupDraw(states);
+
+            m_cache.useVertexCache = useVertexCache;
+            return;
         }
 
-        setupDraw(useVertexCache, states);
+        // Vertices that can't be pre-transformed are copied to a streaming buffer,
+        // rather than being read again by the driver from client memory at each draw
+        if (!useVertexCache && VertexBuffer::isAvailable())
+        {
+            if (!m_vertexStream)
+                m_vertexStream = std::make_unique<priv::VertexStream>();
+
+            const std::size_t first = m_vertexStream->write(vertices, vertexCount);
+
+            // Always enable texture coordinates, like vertex buffers do
+            if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+            // Indexed draws have no base vertex before OpenGL 3.2, the pointers are moved to the first vertex instead
+            const std::size_t offset = indices ? first * sizeof(Vertex) : 0;
+
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(offset + 0)));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(offset + 8)));
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(offset + 12)));
+
+            if (indices)
+                drawIndexedPrimitives(type, indices, indexCount, 0);
+            else
+                drawPrimitives(type, first, vertexCount);
+
+            // Client-side pointers set by the next draws must not be interpreted as buffer offsets
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+            cleanupDraw(states);
+
+            m_cache.useVertexCache        = false;
+            m_cache.texCoordsArrayEnabled = true;
+            return;
+        }
 
         // Check if texture coordinates array is needed, and update client state accordingly
         bool enableTexCoordsArray = (states.texture || states.shader);
@@ -312,7 +480,11 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
             glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
         }
 
-        drawPrimitives(type, 0, vertexCount);
+        if (indices)
+            drawIndexedPrimitives(type, indices, indexCount, 0);
+        else
+            drawPrimitives(type, 0, vertexCount);
+
         cleanupDraw(states);
 
         // Update the cache
@@ -335,7 +507,7 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     // VertexBuffer not supported?
     if (!VertexBuffer::isAvailable())
     {
-        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        err(Log::Level::Warning) << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
         return;
     }
 
@@ -350,10 +522,29 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     if (!vertexCount || !vertexBuffer.getNativeHandle())
         return;
 
+    // Deferred drawing?
+    if (m_queue)
+    {
+        m_queue->draw(vertexBuffer, firstVertex, vertexCount, states);
+        return;
+    }
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         setupDraw(false, states);
 
+        // Core profile: point the vertex attributes to the buffer
+        if (m_coreRenderer)
+        {
+            m_coreRenderer->bindVertexBuffer(vertexBuffer.getNativeHandle());
+
+            drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+            cleanupDraw(states);
+
+            m_cache.useVertexCache = false;
+            return;
+        }
+
         // Bind vertex buffer
         VertexBuffer::bind(&vertexBuffer);
 
@@ -379,6 +570,119 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // IndexBuffer not supported?
+    if (!IndexBuffer::isAvailable())
+    {
+        err(Log::Level::Warning) << "sf::IndexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    // Deferred drawing?
+    if (m_queue)
+    {
+        m_queue->draw(vertexBuffer, indexBuffer, firstIndex, indexCount, states);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        const auto* offset = reinterpret_cast<const void*>(firstIndex * sizeof(std::uint32_t));
+
+        // Core profile: point the vertex attributes and the indices to the buffers
+        if (m_coreRenderer)
+        {
+            m_coreRenderer->bindVertexBuffer(vertexBuffer.getNativeHandle());
+            m_coreRenderer->bindIndexBuffer(indexBuffer.getNativeHandle());
+
+            drawIndexedPrimitives(vertexBuffer.getPrimitiveType(), offset, indexCount, 0);
+            cleanupDraw(states);
+
+            m_cache.useVertexCache = false;
+            return;
+        }
+
+        // Bind vertex and index buffers
+        VertexBuffer::bind(&vertexBuffer);
+        IndexBuffer::bind(&indexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+        drawIndexedPrimitives(vertexBuffer.getPrimitiveType(), offset, indexCount, 0);
+
+        // Unbind the buffers, client-side indices of the next draws must not be interpreted as offsets
+        IndexBuffer::bind(nullptr);
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setRenderQueue(RenderQueue* queue)
+{
+    m_queue = queue;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderQueue* RenderTarget::getRenderQueue() const
+{
+    return m_queue;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setProfiler(RenderProfiler* profiler)
+{
+    m_profiler = profiler;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderProfiler* RenderTarget::getProfiler() const
+{
+    return m_profiler;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -390,6 +694,10 @@ bool RenderTarget::isSrgb() const
 ////////////////////////////////////////////////////////////
 bool RenderTarget::setActive(bool active)
 {
+    // Re-activating the active RenderTarget of a context doesn't change anything
+    if (active && RenderTargetImpl::isActive(m_id))
+        return true;
+
     // Mark this RenderTarget as active or no longer active in the tracking map
     {
         std::scoped_lock lock(RenderTargetImpl::mutex);
@@ -397,6 +705,7 @@ bool RenderTarget::setActive(bool active)
         std::uint64_t contextId = Context::getActiveContextId();
 
         using RenderTargetImpl::contextRenderTargetMap;
+        using RenderTargetImpl::mapChanged;
         auto it = contextRenderTargetMap.find(contextId);
 
         if (active)
@@ -404,6 +713,7 @@ bool RenderTarget::setActive(bool active)
             if (it == contextRenderTargetMap.end())
             {
                 contextRenderTargetMap[contextId] = m_id;
+                mapChanged();
 
                 m_cache.glStatesSet = false;
                 m_cache.enable      = false;
@@ -411,6 +721,7 @@ bool RenderTarget::setActive(bool active)
             else if (it->second != m_id)
             {
                 it->second = m_id;
+                mapChanged();
 
                 m_cache.enable = false;
             }
@@ -418,7 +729,10 @@ bool RenderTarget::setActive(bool active)
         else
         {
             if (it != contextRenderTargetMap.end())
+            {
                 contextRenderTargetMap.erase(it);
+                mapChanged();
+            }
 
             m_cache.enable = false;
         }
@@ -443,16 +757,20 @@ void RenderTarget::pushGLStates()
         }
 #endif
 
+        // Core profile contexts have neither attribute nor matrix stacks
+        if (!m_coreRenderer && !priv::CoreRenderer::isCoreProfile())
+        {
 #ifndef SFML_OPENGL_ES
-        glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
-        glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
+            glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
+            glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
 #endif
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_PROJECTION));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_PROJECTION));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glPushMatrix());
+        }
     }
 
     resetGLStates();
@@ -462,7 +780,7 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if ((RenderTargetImpl::isActive(m_id) || setActive(true)) && !m_coreRenderer)
     {
         glCheck(glMatrixMode(GL_PROJECTION));
         glCheck(glPopMatrix());
@@ -499,34 +817,52 @@ void RenderTarget::resetGLStates()
         // Make sure that extensions are initialized
         priv::ensureExtensionsInit();
 
-        // Make sure that the texture unit which is active is the number 0
-        if (GLEXT_multitexture)
+        // Select the backend, core profile contexts lack the fixed-function pipeline
+        if (!m_coreRenderer && priv::CoreRenderer::isCoreProfile())
+            m_coreRenderer = std::make_unique<priv::CoreRenderer>();
+
+        if (m_coreRenderer)
         {
-            glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
             glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+
+            // Define the default OpenGL states
+            glCheck(glDisable(GL_CULL_FACE));
+            glCheck(glDisable(GL_DEPTH_TEST));
+            glCheck(glEnable(GL_BLEND));
+            m_coreRenderer->bind();
         }
+        else
+        {
+            // Make sure that the texture unit which is active is the number 0
+            if (GLEXT_multitexture)
+            {
+                glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
+                glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+            }
 
-        // Define the default OpenGL states
-        glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_LIGHTING));
-        glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_ALPHA_TEST));
-        glCheck(glEnable(GL_TEXTURE_2D));
-        glCheck(glEnable(GL_BLEND));
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glLoadIdentity());
-        glCheck(glEnableClientState(GL_VERTEX_ARRAY));
-        glCheck(glEnableClientState(GL_COLOR_ARRAY));
-        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            // Define the default OpenGL states
+            glCheck(glDisable(GL_CULL_FACE));
+            glCheck(glDisable(GL_LIGHTING));
+            glCheck(glDisable(GL_DEPTH_TEST));
+            glCheck(glDisable(GL_ALPHA_TEST));
+            glCheck(glEnable(GL_TEXTURE_2D));
+            glCheck(glEnable(GL_BLEND));
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glLoadIdentity());
+            glCheck(glEnableClientState(GL_VERTEX_ARRAY));
+            glCheck(glEnableClientState(GL_COLOR_ARRAY));
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
         m_cache.glStatesSet = true;
 
         // Apply the default SFML states
         applyBlendMode(BlendAlpha);
         applyTexture(nullptr);
+        applyTransform(Transform::Identity);
         if (shaderAvailable)
             applyShader(nullptr);
 
-        if (vertexBufferAvailable)
+        if (vertexBufferAvailable && !m_coreRenderer)
             glCheck(VertexBuffer::bind(nullptr));
 
         m_cache.texCoordsArrayEnabled = true;
@@ -566,8 +902,15 @@ void RenderTarget::applyCurrentView()
     glCheck(glViewport(viewport.left, top, viewport.width, viewport.height));
 
     // Set the projection matrix
+    if (m_coreRenderer)
+    {
+        m_coreRenderer->setProjection(m_view.getTransform().getMatrix().data());
+        m_cache.viewChanged = false;
+        return;
+    }
+
     glCheck(glMatrixMode(GL_PROJECTION));
-    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
+    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix().data()));
 
     // Go back to model-view mode
     glCheck(glMatrixMode(GL_MODELVIEW));
@@ -626,27 +969,72 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     }
 
     m_cache.lastBlendMode = mode;
+
+    if (m_profiler)
+        ++m_profiler->m_current.blendModeChanges;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTransform(const Transform& transform)
 {
+    if (m_coreRenderer)
+    {
+        m_coreRenderer->setModelView(transform.getMatrix().data());
+        return;
+    }
+
     // No need to call glMatrixMode(GL_MODELVIEW), it is always the
     // current mode (for optimization purpose, since it's the most used)
     if (transform == Transform::Identity)
         glCheck(glLoadIdentity());
     else
-        glCheck(glLoadMatrixf(transform.getMatrix()));
+        glCheck(glLoadMatrixf(transform.getMatrix().data()));
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTexture(const Texture* texture)
 {
-    Texture::bind(texture, Texture::Pixels);
+    if (m_coreRenderer)
+    {
+        // Same as Texture::bind, except that the texture matrix is a uniform of our program
+        if (texture && texture->m_texture)
+        {
+            glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
+
+            const Vector2f actualSize(texture->m_actualSize);
+
+            // clang-format off
+            float matrix[16] = {1.f / actualSize.x, 0.f,                0.f, 0.f,
+                                0.f,                1.f / actualSize.y, 0.f, 0.f,
+                                0.f,                0.f,                1.f, 0.f,
+                                0.f,                0.f,                0.f, 1.f};
+            // clang-format on
+
+            if (texture->m_pixelsFlipped)
+            {
+                matrix[5]  = -matrix[5];
+                matrix[13] = static_cast<float>(texture->m_size.y) / actualSize.y;
+            }
+
+            m_coreRenderer->setTextureMatrix(matrix);
+        }
+        else
+        {
+            glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+            m_coreRenderer->setTextureMatrix(nullptr);
+        }
+    }
+    else
+    {
+        Texture::bind(texture, Texture::Pixels);
+    }
 
     m_cache.lastTextureId = texture ? texture->m_cacheId : 0;
+
+    if (m_profiler)
+        ++m_profiler->m_current.textureChanges;
 }
 
 
@@ -654,6 +1042,13 @@ void RenderTarget::applyTexture(const Texture* texture)
 void RenderTarget::applyShader(const Shader* shader)
 {
     Shader::bind(shader);
+
+    // The built-in program must replace the fixed-function pipeline when no shader is bound
+    if (m_coreRenderer)
+        m_coreRenderer->useProgram(shader ? shader->getNativeHandle() : 0);
+
+    if (m_profiler)
+        ++m_profiler->m_current.shaderChanges;
 }
 
 
@@ -672,13 +1067,20 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 
     // First set the persistent OpenGL states if it's the very first call
     if (!m_cache.glStatesSet)
+    {
         resetGLStates();
+    }
+    else if (!m_cache.enable && m_coreRenderer)
+    {
+        // Core profile: another target of the context may have bound its own vertex array object
+        m_coreRenderer->bind();
+    }
 
     if (useVertexCache)
     {
         // Since vertices are transformed, we must use an identity transform to render them
         if (!m_cache.enable || !m_cache.useVertexCache)
-            glCheck(glLoadIdentity());
+            applyTransform(Transform::Identity);
     }
     else
     {
@@ -721,11 +1123,58 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    GLenum                  mode = modes[static_cast<std::size_t>(type)];
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
+
+    // Core profile: the built-in uniforms are uploaded lazily, right before drawing
+    if (m_coreRenderer)
+        m_coreRenderer->applyUniforms();
 
     // Draw the primitives
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+
+    if (m_profiler)
+    {
+        ++m_profiler->m_current.drawCalls;
+        m_profiler->m_current.vertices += vertexCount;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType                type,
+                                         const void*                  indices,
+                                         std::size_t                  indexCount,
+                                         [[maybe_unused]] std::size_t baseVertex)
+{
+    // Find the OpenGL primitive type
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
+
+    // Core profile: the built-in uniforms are uploaded lazily, right before drawing
+    if (m_coreRenderer)
+    {
+        m_coreRenderer->applyUniforms();
+
+#ifndef SFML_OPENGL_ES
+        glCheck(glDrawElementsBaseVertex(mode,
+                                         static_cast<GLsizei>(indexCount),
+                                         GL_UNSIGNED_INT,
+                                         indices,
+                                         static_cast<GLint>(baseVertex)));
+#endif
+    }
+    else
+    {
+        // Base vertices are only used by the core path, older contexts may not support them
+        assert(baseVertex == 0);
+
+        glCheck(glDrawElements(mode, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, indices));
+    }
+
+    if (m_profiler)
+    {
+        ++m_profiler->m_current.drawCalls;
+        m_profiler->m_current.vertices += indexCount;
+    }
 }
 
 
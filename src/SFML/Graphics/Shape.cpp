@@ -29,11 +29,16 @@
 #include <SFML/Graphics/Shape.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 
 namespace
 {
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShapeImpl
+{
 // Compute the normal of a segment
 sf::Vector2f computeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2)
 {
@@ -43,6 +48,31 @@ sf::Vector2f computeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2)
         normal /= length;
     return normal;
 }
+
+// Compute the bounding rectangle of a range of vertices
+sf::FloatRect computeBounds(const sf::Vertex* vertices, std::size_t vertexCount)
+{
+    float left   = vertices[0].position.x;
+    float top    = vertices[0].position.y;
+    float right  = vertices[0].position.x;
+    float bottom = vertices[0].position.y;
+
+    for (std::size_t i = 1; i < vertexCount; ++i)
+    {
+        const sf::Vector2f position = vertices[i].position;
+
+        left   = std::min(left, position.x);
+        right  = std::max(right, position.x);
+        top    = std::min(top, position.y);
+        bottom = std::max(bottom, position.y);
+    }
+
+    return sf::FloatRect({left, top}, {right - left, bottom - top});
+}
+
+// Scratch buffer receiving the points of the shape being updated
+thread_local std::vector<sf::Vector2f> points;
+} // namespace ShapeImpl
 } // namespace
 
 
@@ -122,8 +152,9 @@ const Color& Shape::getOutlineColor() const
 ////////////////////////////////////////////////////////////
 void Shape::setOutlineThickness(float thickness)
 {
+    // Only the outline is extruded, the fill is left untouched
     m_outlineThickness = thickness;
-    update(); // recompute everything because the whole shape must be offset
+    updateOutline();
 }
 
 
@@ -134,6 +165,15 @@ float Shape::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shape::getPoints(Vector2f* points) const
+{
+    const std::size_t count = getPointCount();
+    for (std::size_t i = 0; i < count; ++i)
+        points[i] = getPoint(i);
+}
+
+
 ////////////////////////////////////////////////////////////
 FloatRect Shape::getLocalBounds() const
 {
@@ -155,37 +195,11 @@ Shape::Shape() = default;
 ////////////////////////////////////////////////////////////
 void Shape::update()
 {
-    // Get the total number of points of the shape
-    std::size_t count = getPointCount();
-    if (count < 3)
-    {
-        m_vertices.resize(0);
-        m_outlineVertices.resize(0);
-        return;
-    }
-
-    m_vertices.resize(count + 2); // + 2 for center and repeated first point
-
-    // Position
-    for (std::size_t i = 0; i < count; ++i)
-        m_vertices[i + 1].position = getPoint(i);
-    m_vertices[count + 1].position = m_vertices[1].position;
+    updatePoints();
 
-    // Update the bounding rectangle
-    m_vertices[0]  = m_vertices[1]; // so that the result of getBounds() is correct
-    m_insideBounds = m_vertices.getBounds();
-
-    // Compute the center and make it the first vertex
-    m_vertices[0].position.x = m_insideBounds.left + m_insideBounds.width / 2;
-    m_vertices[0].position.y = m_insideBounds.top + m_insideBounds.height / 2;
-
-    // Color
+    // Every attribute depends on the positions
     updateFillColors();
-
-    // Texture coordinates
     updateTexCoords();
-
-    // Outline
     updateOutline();
 }
 
@@ -193,27 +207,125 @@ void Shape::update()
 ////////////////////////////////////////////////////////////
 void Shape::draw(RenderTarget& target, const RenderStates& states) const
 {
+    // Shapes with less than 3 points have no geometry
+    if (m_pointCount == 0)
+        return;
+
     RenderStates statesCopy(states);
 
     statesCopy.transform *= getTransform();
 
+    const std::size_t fillVertexCount = m_pointCount + 1;
+    const std::size_t fillIndexCount  = m_pointCount * 3;
+    const bool        hasOutline      = m_vertices.size() > fillVertexCount;
+
+    // Without a texture, the inside and the outline are rendered in a single draw call
+    if (!m_texture || !hasOutline)
+    {
+        statesCopy.texture = m_texture;
+        target.draw(m_vertices.data(),
+                    m_vertices.size(),
+                    m_indices.data(),
+                    hasOutline ? m_indices.size() : fillIndexCount,
+                    PrimitiveType::Triangles,
+                    statesCopy);
+        return;
+    }
+
     // Render the inside
     statesCopy.texture = m_texture;
-    target.draw(m_vertices, statesCopy);
+    target.draw(m_vertices.data(),
+                fillVertexCount,
+                m_indices.data(),
+                fillIndexCount,
+                PrimitiveType::Triangles,
+                statesCopy);
 
     // Render the outline
-    if (m_outlineThickness != 0)
+    statesCopy.texture = nullptr;
+    target.draw(m_vertices.data(),
+                m_vertices.size(),
+                m_indices.data() + fillIndexCount,
+                m_indices.size() - fillIndexCount,
+                PrimitiveType::Triangles,
+                statesCopy);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updatePoints()
+{
+    // Get the total number of points of the shape
+    std::size_t count = getPointCount();
+    if (count < 3)
+    {
+        m_vertices.clear();
+        m_indices.clear();
+        m_pointCount = 0;
+        return;
+    }
+
+    // The triangles only depend on the number of points
+    if (count != m_pointCount)
     {
-        statesCopy.texture = nullptr;
-        target.draw(m_outlineVertices, statesCopy);
+        m_pointCount = count;
+        m_indices.resize(count * 9);
+
+        const auto     pointCount = static_cast<std::uint32_t>(count);
+        std::uint32_t* index      = m_indices.data();
+
+        // The inside is a fan of triangles around the center
+        for (std::uint32_t i = 0; i < pointCount; ++i)
+        {
+            *index++ = 0;
+            *index++ = i + 1;
+            *index++ = (i + 1) % pointCount + 1;
+        }
+
+        // The outline is a quad per segment, joining the points to their extruded copies
+        for (std::uint32_t i = 0; i < pointCount; ++i)
+        {
+            const std::uint32_t current = pointCount + 1 + i * 2;
+            const std::uint32_t next    = pointCount + 1 + ((i + 1) % pointCount) * 2;
+
+            *index++ = current;
+            *index++ = current + 1;
+            *index++ = next;
+            *index++ = next;
+            *index++ = current + 1;
+            *index++ = next + 1;
+        }
     }
+
+    // Get all the points at once, rather than with one virtual call per point
+    std::vector<Vector2f>& points = ShapeImpl::points;
+    points.resize(count);
+    getPoints(points.data());
+
+    // The outline vertices follow the center and the points, they are added back by updateOutline
+    m_vertices.resize(count + 1);
+
+    // Position
+    for (std::size_t i = 0; i < count; ++i)
+        m_vertices[i + 1].position = points[i];
+
+    // Update the bounding rectangle
+    m_insideBounds = ShapeImpl::computeBounds(m_vertices.data() + 1, count);
+
+    // Compute the center and make it the first vertex
+    m_vertices[0].position.x = m_insideBounds.left + m_insideBounds.width / 2;
+    m_vertices[0].position.y = m_insideBounds.top + m_insideBounds.height / 2;
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shape::updateFillColors()
 {
-    for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
+    // Shapes with less than 3 points have no geometry
+    if (m_pointCount == 0)
+        return;
+
+    for (std::size_t i = 0; i <= m_pointCount; ++i)
         m_vertices[i].color = m_fillColor;
 }
 
@@ -221,9 +333,13 @@ void Shape::updateFillColors()
 ////////////////////////////////////////////////////////////
 void Shape::updateTexCoords()
 {
+    // Shapes with less than 3 points have no geometry
+    if (m_pointCount == 0)
+        return;
+
     FloatRect convertedTextureRect(m_textureRect);
 
-    for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
+    for (std::size_t i = 0; i <= m_pointCount; ++i)
     {
         float xratio = m_insideBounds.width > 0 ? (m_vertices[i].position.x - m_insideBounds.left) / m_insideBounds.width : 0;
         float yratio = m_insideBounds.height > 0 ? (m_vertices[i].position.y - m_insideBounds.top) / m_insideBounds.height
@@ -237,35 +353,47 @@ void Shape::updateTexCoords()
 ////////////////////////////////////////////////////////////
 void Shape::updateOutline()
 {
+    const std::size_t count = m_pointCount;
+
+    // Shapes with less than 3 points have no geometry
+    if (count == 0)
+    {
+        m_bounds = FloatRect();
+        return;
+    }
+
     // Return if there is no outline
     if (m_outlineThickness == 0.f)
     {
-        m_outlineVertices.clear();
+        m_vertices.resize(count + 1);
         m_bounds = m_insideBounds;
         return;
     }
 
-    std::size_t count = m_vertices.getVertexCount() - 2;
-    m_outlineVertices.resize((count + 1) * 2);
+    m_vertices.resize(count * 3 + 1);
+
+    const Vector2f center  = m_vertices[0].position;
+    Vertex*        outline = m_vertices.data() + count + 1;
+
+    // Each segment is shared by two points, so its normal is computed once and carried to the next point
+    Vector2f previousNormal = ShapeImpl::computeNormal(m_vertices[count].position, m_vertices[1].position);
 
     for (std::size_t i = 0; i < count; ++i)
     {
-        std::size_t index = i + 1;
-
         // Get the two segments shared by the current point
-        Vector2f p0 = (i == 0) ? m_vertices[count].position : m_vertices[index - 1].position;
-        Vector2f p1 = m_vertices[index].position;
-        Vector2f p2 = m_vertices[index + 1].position;
+        Vector2f p1 = m_vertices[i + 1].position;
+        Vector2f p2 = m_vertices[(i + 1) % count + 1].position;
 
         // Compute their normal
-        Vector2f n1 = computeNormal(p0, p1);
-        Vector2f n2 = computeNormal(p1, p2);
+        Vector2f n1    = previousNormal;
+        Vector2f n2    = ShapeImpl::computeNormal(p1, p2);
+        previousNormal = n2;
 
         // Make sure that the normals point towards the outside of the shape
         // (this depends on the order in which the points were defined)
-        if (n1.dot(m_vertices[0].position - p1) > 0)
+        if (n1.dot(center - p1) > 0)
             n1 = -n1;
-        if (n2.dot(m_vertices[0].position - p1) > 0)
+        if (n2.dot(center - p1) > 0)
             n2 = -n2;
 
         // Combine them to get the extrusion direction
@@ -273,27 +401,23 @@ void Shape::updateOutline()
         Vector2f normal = (n1 + n2) / factor;
 
         // Update the outline points
-        m_outlineVertices[i * 2 + 0].position = p1;
-        m_outlineVertices[i * 2 + 1].position = p1 + normal * m_outlineThickness;
+        outline[i * 2 + 0].position = p1;
+        outline[i * 2 + 1].position = p1 + normal * m_outlineThickness;
     }
 
-    // Duplicate the first point at the end, to close the outline
-    m_outlineVertices[count * 2 + 0].position = m_outlineVertices[0].position;
-    m_outlineVertices[count * 2 + 1].position = m_outlineVertices[1].position;
-
-    // Update outline colors
+    // The outline vertices may have been added back
     updateOutlineColors();
 
     // Update the shape's bounds
-    m_bounds = m_outlineVertices.getBounds();
+    m_bounds = ShapeImpl::computeBounds(outline, count * 2);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shape::updateOutlineColors()
 {
-    for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
-        m_outlineVertices[i].color = m_outlineColor;
+    for (std::size_t i = m_pointCount + 1; i < m_vertices.size(); ++i)
+        m_vertices[i].color = m_outlineColor;
 }
 
 } // namespace sf
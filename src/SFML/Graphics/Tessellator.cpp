@@ -0,0 +1,477 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Tessellator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TessellatorImpl
+{
+// Vertex of a contour, stored in a circular doubly linked list
+struct Node
+{
+    std::uint32_t point; // Index of the point in the polygon
+    std::size_t   prev;  // Index of the previous node
+    std::size_t   next;  // Index of the next node
+};
+
+constexpr std::size_t invalidNode = std::numeric_limits<std::size_t>::max();
+
+// Twice the signed area of the triangle (a, b, c), positive if it turns left
+float cross(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c)
+{
+    return (b - a).cross(c - b);
+}
+
+// Check whether p lies inside (or on the border of) the left-turning triangle (a, b, c)
+bool isInTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f p)
+{
+    return ((b - a).cross(p - a) >= 0.f) && ((c - b).cross(p - b) >= 0.f) && ((a - c).cross(p - c) >= 0.f);
+}
+
+// Link the points of a contour into a circular list, in the requested orientation,
+// and return one of its nodes (or invalidNode if the contour has no area)
+std::size_t linkContour(const std::vector<sf::Vector2f>& points,
+                        std::size_t                      first,
+                        std::size_t                      count,
+                        bool                             counterClockwise,
+                        std::vector<Node>&               nodes)
+{
+    const bool        reverse = (sf::priv::computeSignedArea(points.data() + first, count) > 0.f) != counterClockwise;
+    const std::size_t start   = nodes.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t point = first + (reverse ? count - 1 - i : i);
+
+        // Skip consecutive duplicates, they would produce degenerate triangles
+        if ((nodes.size() > start) && (points[point] == points[nodes.back().point]))
+            continue;
+
+        nodes.push_back({static_cast<std::uint32_t>(point), nodes.size() - 1, nodes.size() + 1});
+    }
+
+    while ((nodes.size() > start + 1) && (points[nodes.back().point] == points[nodes[start].point]))
+        nodes.pop_back();
+
+    if (nodes.size() < start + 3)
+    {
+        nodes.resize(start);
+        return invalidNode;
+    }
+
+    // Close the ring
+    nodes[start].prev = nodes.size() - 1;
+    nodes.back().next = start;
+
+    return start;
+}
+
+// Unlink a node from its ring
+void removeNode(std::vector<Node>& nodes, std::size_t node)
+{
+    nodes[nodes[node].prev].next = nodes[node].next;
+    nodes[nodes[node].next].prev = nodes[node].prev;
+}
+
+// Check whether the direction from a node to p points inside the polygon, locally to the node
+bool isLocallyInside(const std::vector<sf::Vector2f>& points,
+                     const std::vector<Node>&         nodes,
+                     std::size_t                      node,
+                     sf::Vector2f                     p)
+{
+    const sf::Vector2f a = points[nodes[nodes[node].prev].point];
+    const sf::Vector2f b = points[nodes[node].point];
+    const sf::Vector2f c = points[nodes[nodes[node].next].point];
+
+    const bool leftOfIncoming = (b - a).cross(p - a) > 0.f;
+    const bool leftOfOutgoing = (c - b).cross(p - b) > 0.f;
+
+    // The inside of a convex corner is the intersection of the two half-planes, the inside of a reflex one their union
+    return (cross(a, b, c) >= 0.f) ? (leftOfIncoming && leftOfOutgoing) : (leftOfIncoming || leftOfOutgoing);
+}
+
+// Connect a hole to the outer ring with a pair of coincident edges (David Eberly's method),
+// so that the outer ring becomes a single simple polygon that includes the hole contour
+bool bridgeHole(const std::vector<sf::Vector2f>& points, std::vector<Node>& nodes, std::size_t outer, std::size_t hole)
+{
+    // Find the rightmost point of the hole: nothing of the hole can be crossed by a ray cast from it towards +x
+    std::size_t holeNode = hole;
+    for (std::size_t node = nodes[hole].next; node != hole; node = nodes[node].next)
+    {
+        const sf::Vector2f p    = points[nodes[node].point];
+        const sf::Vector2f best = points[nodes[holeNode].point];
+        if ((p.x > best.x) || ((p.x == best.x) && (p.y < best.y)))
+            holeNode = node;
+    }
+
+    const sf::Vector2f m = points[nodes[holeNode].point];
+
+    // Find the closest edge of the outer ring hit by the ray, and its rightmost end
+    float       hitX       = std::numeric_limits<float>::max();
+    std::size_t bridgeNode = invalidNode;
+    std::size_t node       = outer;
+    do
+    {
+        const std::size_t  next = nodes[node].next;
+        const sf::Vector2f a    = points[nodes[node].point];
+        const sf::Vector2f b    = points[nodes[next].point];
+
+        if ((a.y != b.y) && (std::min(a.y, b.y) <= m.y) && (m.y <= std::max(a.y, b.y)))
+        {
+            const float x = a.x + (m.y - a.y) * (b.x - a.x) / (b.y - a.y);
+            if ((x >= m.x) && (x < hitX))
+            {
+                hitX       = x;
+                bridgeNode = (a.x > b.x) ? node : next;
+            }
+        }
+
+        node = next;
+    } while (node != outer);
+
+    if (bridgeNode == invalidNode)
+        return false;
+
+    // If the ray doesn't hit the chosen end exactly, a reflex vertex may lie inside the triangle
+    // (m, hit, end) and hide the end from m: take the one that makes the smallest angle with the ray
+    const sf::Vector2f hit(hitX, m.y);
+    const sf::Vector2f end = points[nodes[bridgeNode].point];
+    if (hit != end)
+    {
+        const bool  above      = end.y < m.y;
+        const auto  inTriangle = [&](sf::Vector2f p)
+        { return above ? isInTriangle(m, end, hit, p) : isInTriangle(m, hit, end, p); };
+        float       bestTangent = std::numeric_limits<float>::max();
+        std::size_t candidate   = outer;
+        do
+        {
+            const sf::Vector2f prev = points[nodes[nodes[candidate].prev].point];
+            const sf::Vector2f p    = points[nodes[candidate].point];
+            const sf::Vector2f next = points[nodes[nodes[candidate].next].point];
+
+            if ((p != end) && (p.x > m.x) && inTriangle(p) && (cross(prev, p, next) < 0.f))
+            {
+                const float tangent = std::abs(p.y - m.y) / (p.x - m.x);
+                if ((tangent < bestTangent) ||
+                    ((tangent == bestTangent) && (p.x < points[nodes[bridgeNode].point].x)))
+                {
+                    bestTangent = tangent;
+                    bridgeNode  = candidate;
+                }
+            }
+
+            candidate = nodes[candidate].next;
+        } while (candidate != outer);
+    }
+
+    // Previous holes may have duplicated the chosen point: use the copy whose corner sees the hole
+    const sf::Vector2f bridgePoint = points[nodes[bridgeNode].point];
+    node                           = outer;
+    do
+    {
+        if ((points[nodes[node].point] == bridgePoint) && isLocallyInside(points, nodes, node, m))
+        {
+            bridgeNode = node;
+            break;
+        }
+
+        node = nodes[node].next;
+    } while (node != outer);
+
+    // Splice the hole in: bridge -> m -> (hole) -> m' -> bridge' -> (rest of the outer ring)
+    const std::size_t bridgeCopy = nodes.size();
+    const std::size_t holeCopy   = bridgeCopy + 1;
+    nodes.push_back(nodes[bridgeNode]);
+    nodes.push_back(nodes[holeNode]);
+
+    const std::size_t bridgeNext = nodes[bridgeNode].next;
+    const std::size_t holePrev   = nodes[holeNode].prev;
+
+    nodes[bridgeNode].next = holeNode;
+    nodes[holeNode].prev   = bridgeNode;
+    nodes[holePrev].next   = holeCopy;
+    nodes[holeCopy].prev   = holePrev;
+    nodes[holeCopy].next   = bridgeCopy;
+    nodes[bridgeCopy].prev = holeCopy;
+    nodes[bridgeCopy].next = bridgeNext;
+    nodes[bridgeNext].prev = bridgeCopy;
+
+    return true;
+}
+
+// Check whether no other point of the ring lies inside the triangle formed by a node and its neighbors
+bool isEar(const std::vector<sf::Vector2f>& points, const std::vector<Node>& nodes, std::size_t ear)
+{
+    const std::size_t  prev = nodes[ear].prev;
+    const std::size_t  next = nodes[ear].next;
+    const sf::Vector2f a    = points[nodes[prev].point];
+    const sf::Vector2f b    = points[nodes[ear].point];
+    const sf::Vector2f c    = points[nodes[next].point];
+
+    for (std::size_t node = nodes[next].next; node != prev; node = nodes[node].next)
+    {
+        // Points that coincide with a corner (the two ends of a bridge) don't block the ear
+        const sf::Vector2f p = points[nodes[node].point];
+        if ((p != a) && (p != b) && (p != c) && isInTriangle(a, b, c, p))
+            return false;
+    }
+
+    return true;
+}
+} // namespace TessellatorImpl
+} // namespace
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+bool triangulatePolygon(const std::vector<Vector2f>&    points,
+                        const std::vector<std::size_t>& contourSizes,
+                        std::vector<std::uint32_t>&     indices)
+{
+    using TessellatorImpl::invalidNode;
+
+    if (contourSizes.empty())
+        return true;
+
+    // Nodes are reused across calls, shapes get re-triangulated whenever one of their points moves
+    thread_local std::vector<TessellatorImpl::Node>          nodes;
+    thread_local std::vector<std::pair<float, std::size_t>> holes; // Rightmost x and first node of each hole
+    nodes.clear();
+    holes.clear();
+
+    // The outer contour turns counter-clockwise (positive area) and the holes clockwise,
+    // so that the inside of the polygon is always on the left of the edges
+    const std::size_t outer = TessellatorImpl::linkContour(points, 0, contourSizes[0], true, nodes);
+    if (outer == invalidNode)
+        return true;
+
+    std::size_t first = contourSizes[0];
+    for (std::size_t i = 1; i < contourSizes.size(); ++i)
+    {
+        const std::size_t hole = TessellatorImpl::linkContour(points, first, contourSizes[i], false, nodes);
+        if (hole != invalidNode)
+            holes.emplace_back(points[nodes[hole].point].x, hole);
+
+        first += contourSizes[i];
+    }
+
+    // Bridge the holes from right to left, so that a bridge never crosses a hole that is not bridged yet
+    for (auto& [maxX, hole] : holes)
+    {
+        for (std::size_t node = nodes[hole].next; node != hole; node = nodes[node].next)
+            maxX = std::max(maxX, points[nodes[node].point].x);
+    }
+    std::sort(holes.begin(), holes.end(), [](const auto& left, const auto& right) { return left.first > right.first; });
+
+    bool success = true;
+    for (const auto& hole : holes)
+        success = TessellatorImpl::bridgeHole(points, nodes, outer, hole.second) && success;
+
+    std::size_t remaining = 0;
+    std::size_t node      = outer;
+    do
+    {
+        ++remaining;
+        node = nodes[node].next;
+    } while (node != outer);
+
+    // Clip ears until only a triangle is left
+    std::size_t ear   = outer;
+    std::size_t stall = 0;
+    while (remaining > 2)
+    {
+        const std::size_t prev = nodes[ear].prev;
+        const std::size_t next = nodes[ear].next;
+        const float       turn = TessellatorImpl::cross(points[nodes[prev].point],
+                                                  points[nodes[ear].point],
+                                                  points[nodes[next].point]);
+
+        // Collinear points (and spikes) don't cover any area, they are removed without producing a triangle
+        if (turn == 0.f)
+        {
+            TessellatorImpl::removeNode(nodes, ear);
+            --remaining;
+            ear   = next;
+            stall = 0;
+            continue;
+        }
+
+        // If a whole turn found no ear the polygon is self-intersecting: clip convex corners anyway
+        // so that the shape is still (approximately) drawn
+        if ((turn > 0.f) && ((stall >= remaining) || TessellatorImpl::isEar(points, nodes, ear)))
+        {
+            success = success && (stall < remaining);
+
+            indices.push_back(nodes[prev].point);
+            indices.push_back(nodes[ear].point);
+            indices.push_back(nodes[next].point);
+
+            TessellatorImpl::removeNode(nodes, ear);
+            --remaining;
+            ear   = next;
+            stall = 0;
+            continue;
+        }
+
+        // Not a single convex corner left: give up
+        if (++stall >= 2 * remaining)
+            return false;
+
+        ear = next;
+    }
+
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////
+void extrudeContour(const Vector2f*         points,
+                    std::size_t             count,
+                    float                   width,
+                    PolygonShape::JoinStyle join,
+                    float                   miterLimit,
+                    std::vector<RingPoint>& ring)
+{
+    ring.clear();
+
+    // Ignore the consecutive duplicates, they have no direction
+    thread_local std::vector<std::size_t> corners;
+    corners.clear();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (corners.empty() || (points[i] != points[corners.back()]))
+            corners.push_back(i);
+    }
+
+    while ((corners.size() > 1) && (points[corners.back()] == points[corners.front()]))
+        corners.pop_back();
+
+    if (corners.size() < 2)
+        return;
+
+    // Round joins are approximated with segments that stay within a quarter of a unit of the exact arc
+    constexpr float tolerance = 0.25f;
+    const float     radius    = std::abs(width);
+    const float     arcStep   = (radius > tolerance) ? 2.f * std::acos(1.f - tolerance / radius) : 1.5707963f;
+
+    const std::size_t cornerCount = corners.size();
+    Vector2f direction = (points[corners[0]] - points[corners[cornerCount - 1]]).normalized();
+
+    for (std::size_t i = 0; i < cornerCount; ++i)
+    {
+        const std::size_t corner        = corners[i];
+        const Vector2f    nextDirection = (points[corners[(i + 1) % cornerCount]] - points[corner]).normalized();
+        const Vector2f    normal        = direction.perpendicular();
+        const Vector2f    nextNormal    = nextDirection.perpendicular();
+        const float       cosine        = normal.dot(nextNormal);
+
+        // The two offset segments intersect when the corner turns towards the extruded side,
+        // and leave a gap to fill with a join when it turns away from it
+        const bool  hasGap = nextDirection.dot(normal) * width < 0.f;
+        const bool  uTurn  = 1.f + cosine < 1e-6f;
+        Vector2f    miter  = uTurn ? normal : (normal + nextNormal) / (1.f + cosine);
+
+        direction = nextDirection;
+
+        if (!hasGap)
+        {
+            // Limit the length of the intersection at sharp corners, it would go way past the neighbor segments
+            if (uTurn)
+            {
+                ring.push_back({corner, normal * width});
+                ring.push_back({corner, nextNormal * width});
+            }
+            else
+            {
+                if (miter.lengthSq() > miterLimit * miterLimit)
+                    miter = miter.normalized() * miterLimit;
+
+                ring.push_back({corner, miter * width});
+            }
+            continue;
+        }
+
+        switch (join)
+        {
+            case PolygonShape::JoinStyle::Miter:
+                if (!uTurn && (miter.lengthSq() <= miterLimit * miterLimit))
+                {
+                    ring.push_back({corner, miter * width});
+                    break;
+                }
+                [[fallthrough]];
+
+            case PolygonShape::JoinStyle::Bevel:
+                ring.push_back({corner, normal * width});
+                ring.push_back({corner, nextNormal * width});
+                break;
+
+            case PolygonShape::JoinStyle::Round:
+            {
+                const float angle = std::atan2(normal.cross(nextNormal), cosine);
+                const auto  steps = static_cast<std::size_t>(std::max(1.f, std::ceil(std::abs(angle) / arcStep)));
+
+                for (std::size_t step = 0; step <= steps; ++step)
+                {
+                    const float    stepAngle = angle * static_cast<float>(step) / static_cast<float>(steps);
+                    const float    cos       = std::cos(stepAngle);
+                    const float    sin       = std::sin(stepAngle);
+                    const Vector2f rotated(normal.x * cos - normal.y * sin, normal.x * sin + normal.y * cos);
+
+                    ring.push_back({corner, rotated * width});
+                }
+                break;
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+float computeSignedArea(const Vector2f* points, std::size_t count)
+{
+    float area = 0.f;
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++)
+        area += points[j].cross(points[i]);
+
+    return area / 2.f;
+}
+
+} // namespace priv
+} // namespace sf
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PolygonShape.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Point of a ring extruded from a contour
+///
+////////////////////////////////////////////////////////////
+struct RingPoint
+{
+    std::size_t corner; //!< Index of the contour point the ring point is extruded from
+    Vector2f    offset; //!< Offset of the ring point from its contour point
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Triangulate a polygon with holes
+///
+/// The holes are first bridged to the outer contour, then
+/// the resulting simple polygon is split by ear clipping.
+/// Contours can be given in any orientation. Consecutive
+/// duplicate points and collinear points are allowed.
+///
+/// \param points       Points of all the contours, one contour after the other
+/// \param contourSizes Number of points of each contour, the outer contour first, then the holes
+/// \param indices      Receives the triangle list, as indices into \a points (it is appended to)
+///
+/// \return True if the polygon was fully triangulated, false if it is self-intersecting
+///         (the triangles found until then are still appended)
+///
+////////////////////////////////////////////////////////////
+bool triangulatePolygon(const std::vector<Vector2f>&    points,
+                        const std::vector<std::size_t>& contourSizes,
+                        std::vector<std::uint32_t>&     indices);
+
+////////////////////////////////////////////////////////////
+/// \brief Extrude a closed contour on one side
+///
+/// The side of each segment is given by its perpendicular
+/// vector (Vector2::perpendicular): a positive \a width
+/// extrudes along it, a negative one in the opposite
+/// direction. Corners on the inner side of a turn always
+/// produce a single (miter) point, corners on the outer
+/// side produce the points of the requested join.
+///
+/// \param points     Points of the contour
+/// \param count      Number of points of the contour
+/// \param width      Signed width of the extrusion
+/// \param join       Style of the joins on the outer side of the turns
+/// \param miterLimit Maximum ratio between the length of a miter and \a width
+/// \param ring       Receives the extruded ring, in contour order (it is cleared first)
+///
+////////////////////////////////////////////////////////////
+void extrudeContour(const Vector2f*         points,
+                    std::size_t             count,
+                    float                   width,
+                    PolygonShape::JoinStyle join,
+                    float                   miterLimit,
+                    std::vector<RingPoint>& ring);
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the signed area of a closed contour
+///
+/// \param points Points of the contour
+/// \param count  Number of points of the contour
+///
+/// \return Area of the contour, positive if its perpendicular vectors point inside
+///
+////////////////////////////////////////////////////////////
+float computeSignedArea(const Vector2f* points, std::size_t count);
+
+} // namespace priv
+} // namespace sf
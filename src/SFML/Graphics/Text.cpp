@@ -32,35 +32,39 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 
 namespace
 {
-// Add an underline or strikethrough line to the vertex array
-void addLine(sf::VertexArray& vertices,
-             float            lineLength,
-             float            lineTop,
-             const sf::Color& color,
-             float            offset,
-             float            thickness,
-             float            outlineThickness = 0)
+// Add an underline or strikethrough line to the vertices
+void addLine(std::vector<sf::Vertex>& vertices,
+             float                    lineLength,
+             float                    lineTop,
+             const sf::Color&         color,
+             float                    offset,
+             float                    thickness,
+             float                    outlineThickness = 0)
 {
     float top    = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
     float bottom = top + std::floor(thickness + 0.5f);
 
-    vertices.append(sf::Vertex(sf::Vector2f(-outlineThickness, top - outlineThickness), color, sf::Vector2f(1, 1)));
-    vertices.append(
-        sf::Vertex(sf::Vector2f(lineLength + outlineThickness, top - outlineThickness), color, sf::Vector2f(1, 1)));
-    vertices.append(sf::Vertex(sf::Vector2f(-outlineThickness, bottom + outlineThickness), color, sf::Vector2f(1, 1)));
-    vertices.append(sf::Vertex(sf::Vector2f(-outlineThickness, bottom + outlineThickness), color, sf::Vector2f(1, 1)));
-    vertices.append(
-        sf::Vertex(sf::Vector2f(lineLength + outlineThickness, top - outlineThickness), color, sf::Vector2f(1, 1)));
-    vertices.append(
-        sf::Vertex(sf::Vector2f(lineLength + outlineThickness, bottom + outlineThickness), color, sf::Vector2f(1, 1)));
+    vertices.emplace_back(sf::Vector2f(-outlineThickness, top - outlineThickness), color, sf::Vector2f(1, 1));
+    vertices.emplace_back(sf::Vector2f(lineLength + outlineThickness, top - outlineThickness),
+                          color,
+                          sf::Vector2f(1, 1));
+    vertices.emplace_back(sf::Vector2f(-outlineThickness, bottom + outlineThickness), color, sf::Vector2f(1, 1));
+    vertices.emplace_back(sf::Vector2f(lineLength + outlineThickness, bottom + outlineThickness),
+                          color,
+                          sf::Vector2f(1, 1));
 }
 
-// Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+// Add a glyph quad to the vertices
+void addGlyphQuad(std::vector<sf::Vertex>& vertices,
+                  sf::Vector2f             position,
+                  const sf::Color&         color,
+                  const sf::Glyph&         glyph,
+                  float                    italicShear)
 {
     float padding = 1.0;
 
@@ -74,20 +78,22 @@ void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Co
     float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
     float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
 
-    vertices.append(
-        sf::Vertex(sf::Vector2f(position.x + left - italicShear * top, position.y + top), color, sf::Vector2f(u1, v1)));
-    vertices.append(
-        sf::Vertex(sf::Vector2f(position.x + right - italicShear * top, position.y + top), color, sf::Vector2f(u2, v1)));
-    vertices.append(
-        sf::Vertex(sf::Vector2f(position.x + left - italicShear * bottom, position.y + bottom), color, sf::Vector2f(u1, v2)));
-    vertices.append(
-        sf::Vertex(sf::Vector2f(position.x + left - italicShear * bottom, position.y + bottom), color, sf::Vector2f(u1, v2)));
-    vertices.append(
-        sf::Vertex(sf::Vector2f(position.x + right - italicShear * top, position.y + top), color, sf::Vector2f(u2, v1)));
-    vertices.append(sf::Vertex(sf::Vector2f(position.x + right - italicShear * bottom, position.y + bottom),
-                               color,
-                               sf::Vector2f(u2, v2)));
+    vertices.emplace_back(sf::Vector2f(position.x + left - italicShear * top, position.y + top),
+                          color,
+                          sf::Vector2f(u1, v1));
+    vertices.emplace_back(sf::Vector2f(position.x + right - italicShear * top, position.y + top),
+                          color,
+                          sf::Vector2f(u2, v1));
+    vertices.emplace_back(sf::Vector2f(position.x + left - italicShear * bottom, position.y + bottom),
+                          color,
+                          sf::Vector2f(u1, v2));
+    vertices.emplace_back(sf::Vector2f(position.x + right - italicShear * bottom, position.y + bottom),
+                          color,
+                          sf::Vector2f(u2, v2));
 }
+
+// Scratch buffer receiving the fill quads while the outline quads are generated, the fill is drawn last
+thread_local std::vector<sf::Vertex> textFillVertices;
 } // namespace
 
 
@@ -199,7 +205,7 @@ void Text::setFillColor(const Color& color)
         // (if geometry is updated anyway, we can skip this step)
         if (!m_geometryNeedUpdate)
         {
-            for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
+            for (std::size_t i = m_outlineVertexCount; i < m_vertices.size(); ++i)
                 m_vertices[i].color = m_fillColor;
         }
     }
@@ -217,8 +223,8 @@ void Text::setOutlineColor(const Color& color)
         // (if geometry is updated anyway, we can skip this step)
         if (!m_geometryNeedUpdate)
         {
-            for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
-                m_outlineVertices[i].color = m_outlineColor;
+            for (std::size_t i = 0; i < m_outlineVertexCount; ++i)
+                m_vertices[i].color = m_outlineColor;
         }
     }
 }
@@ -381,11 +387,13 @@ void Text::draw(RenderTarget& target, const RenderStates& states) const
         statesCopy.transform *= getTransform();
         statesCopy.texture = &m_font->getTexture(m_characterSize);
 
-        // Only draw the outline if there is something to draw
-        if (m_outlineThickness != 0)
-            target.draw(m_outlineVertices, statesCopy);
-
-        target.draw(m_vertices, statesCopy);
+        // The outline quads come first, so that a single draw call renders them below the fill
+        target.draw(m_vertices.data(),
+                    m_vertices.size(),
+                    m_indices.data(),
+                    m_vertices.size() / 4 * 6,
+                    PrimitiveType::Triangles,
+                    statesCopy);
     }
 }
 
@@ -407,9 +415,11 @@ void Text::ensureGeometryUpdate() const
     m_geometryNeedUpdate = false;
 
     // Clear the previous geometry
+    std::vector<Vertex>& fillVertices = textFillVertices;
+    fillVertices.clear();
     m_vertices.clear();
-    m_outlineVertices.clear();
-    m_bounds = FloatRect();
+    m_outlineVertexCount = 0;
+    m_bounds             = FloatRect();
 
     // No text: nothing to draw
     if (m_string.isEmpty())
@@ -457,19 +467,19 @@ void Text::ensureGeometryUpdate() const
         // If we're using the underlined style and there's a new line, draw a line
         if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+            addLine(fillVertices, x, y, m_fillColor, underlineOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+                addLine(m_vertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
         }
 
         // If we're using the strike through style and there's a new line, draw a line across all characters
         if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+            addLine(fillVertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+                addLine(m_vertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
         }
 
         prevChar = curChar;
@@ -509,14 +519,14 @@ void Text::ensureGeometryUpdate() const
             const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            addGlyphQuad(m_vertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        addGlyphQuad(fillVertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
 
         // Update the current bounds
         float left   = glyph.bounds.left;
@@ -546,19 +556,31 @@ void Text::ensureGeometryUpdate() const
     // If we're using the underlined style, add the last line
     if (isUnderlined && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+        addLine(fillVertices, x, y, m_fillColor, underlineOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            addLine(m_vertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
     }
 
     // If we're using the strike through style, add the last line across all characters
     if (isStrikeThrough && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+        addLine(fillVertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            addLine(m_vertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+    }
+
+    // Append the fill quads to the outline quads
+    m_outlineVertexCount = m_vertices.size();
+    m_vertices.insert(m_vertices.end(), fillVertices.begin(), fillVertices.end());
+
+    // Every quad is made of two triangles, which only depend on its position in the array
+    const std::size_t quadCount = m_vertices.size() / 4;
+    for (auto quad = static_cast<std::uint32_t>(m_indices.size() / 6); quad < quadCount; ++quad)
+    {
+        const std::uint32_t first = quad * 4;
+        m_indices.insert(m_indices.end(), {first, first + 1, first + 2, first + 2, first + 1, first + 3});
     }
 
     // Update the bounding rectangle
@@ -0,0 +1,272 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <ostream>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(const Vector2u& pageSize, unsigned int padding) : m_pageSize(pageSize), m_padding(padding)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> TextureAtlas::add(const Image& image)
+{
+    const Vector2u imageSize = image.getSize();
+    if ((imageSize.x == 0) || (imageSize.y == 0))
+    {
+        err() << "Failed to add image to texture atlas, invalid size (" << imageSize.x << "x" << imageSize.y << ")"
+              << std::endl;
+        return std::nullopt;
+    }
+
+    // Reserve room for the gutter on each side of the image
+    const Vector2u slotSize = imageSize + Vector2u(2 * m_padding, 2 * m_padding);
+
+    const unsigned int maxSize = Texture::getMaximumSize();
+    if ((slotSize.x > maxSize) || (slotSize.y > maxSize))
+    {
+        err() << "Failed to add image to texture atlas, its size is too high "
+              << "(" << slotSize.x << "x" << slotSize.y << " with padding, "
+              << "maximum is " << maxSize << "x" << maxSize << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    // Find room in the existing pages, oldest first
+    std::optional<IntRect> slot;
+    std::size_t            pageIndex = 0;
+    while ((pageIndex < m_pages.size()) && !(slot = findRect(m_pages[pageIndex], slotSize)))
+        ++pageIndex;
+
+    // All pages are full: create a new one
+    if (!slot)
+    {
+        Page&          page = m_pages.emplace_back();
+        const Vector2u pageSize(std::min(std::max(m_pageSize.x, slotSize.x), maxSize),
+                                std::min(std::max(m_pageSize.y, slotSize.y), maxSize));
+
+        if (!page.texture.create(pageSize))
+        {
+            err() << "Failed to add image to texture atlas, failed to create page texture" << std::endl;
+            m_pages.pop_back();
+            return std::nullopt;
+        }
+
+        page.texture.setSmooth(m_isSmooth);
+        pageIndex = m_pages.size() - 1;
+        slot      = findRect(page, slotSize);
+        assert(slot && "The new page is big enough for the image");
+    }
+
+    Texture&       texture = m_pages[pageIndex].texture;
+    const Vector2u slotPosition(slot->getPosition());
+
+    if (m_padding > 0)
+    {
+        // Build the image with its gutter, filled with copies of its edge pixels
+        Image slotImage;
+        slotImage.create(slotSize);
+        [[maybe_unused]] const bool copied = slotImage.copy(image, {m_padding, m_padding});
+        assert(copied && "The slot is big enough for the image");
+
+        const unsigned int right  = m_padding + imageSize.x - 1;
+        const unsigned int bottom = m_padding + imageSize.y - 1;
+        for (unsigned int y = 0; y < slotSize.y; ++y)
+        {
+            const bool         innerRow = (y >= m_padding) && (y <= bottom);
+            const unsigned int sourceY  = std::clamp(y, m_padding, bottom);
+
+            for (unsigned int x = 0; x < slotSize.x; ++x)
+            {
+                // Skip the pixels of the image itself
+                if (innerRow && (x == m_padding))
+                    x = right + 1;
+
+                const unsigned int sourceX = std::clamp(x, m_padding, right);
+                slotImage.setPixel({x, y}, slotImage.getPixel({sourceX, sourceY}));
+            }
+        }
+
+        texture.update(slotImage, slotPosition);
+    }
+    else
+    {
+        texture.update(image, slotPosition);
+    }
+
+    // The texture rectangle excludes the gutter
+    const Vector2u imagePosition = slotPosition + Vector2u(m_padding, m_padding);
+    m_regions.push_back({pageIndex, IntRect(Vector2i(imagePosition), Vector2i(imageSize))});
+
+    return m_regions.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture(std::size_t handle) const
+{
+    assert(handle < m_regions.size() && "Invalid texture atlas handle");
+    return m_pages[m_regions[handle].page].texture;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect TextureAtlas::getTextureRect(std::size_t handle) const
+{
+    assert(handle < m_regions.size() && "Invalid texture atlas handle");
+    return m_regions[handle].rect;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getImageCount() const
+{
+    return m_regions.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getPage(std::size_t index) const
+{
+    assert(index < m_pages.size() && "Invalid texture atlas page index");
+    return m_pages[index].texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (Page& page : m_pages)
+        page.texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::generateMipmap()
+{
+    bool success = true;
+
+    for (Page& page : m_pages)
+        success = page.texture.generateMipmap() && success;
+
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IntRect> TextureAtlas::findRect(Page& page, const Vector2u& size)
+{
+    // Find the row that fits well the image (same heuristic as the glyph pages of sf::Font)
+    Row*  row       = nullptr;
+    float bestRatio = 0;
+    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
+    {
+        float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
+
+        // Ignore rows that are either too small or too high
+        if ((ratio < 0.7f) || (ratio > 1.f))
+            continue;
+
+        // Check if there's enough horizontal space left in the row
+        if (size.x > page.texture.getSize().x - it->width)
+            continue;
+
+        // Make sure that this new row is the best found so far
+        if (ratio < bestRatio)
+            continue;
+
+        // The current row passed all the tests: we can select it
+        row       = &*it;
+        bestRatio = ratio;
+    }
+
+    // If we didn't find a matching row, create a new one (10% taller than the image)
+    if (!row)
+    {
+        while ((page.nextRow + size.y > page.texture.getSize().y) || (size.x > page.texture.getSize().x))
+        {
+            // Not enough space: resize the texture if possible
+            Vector2u textureSize = page.texture.getSize();
+            if ((textureSize.x * 2 > Texture::getMaximumSize()) || (textureSize.y * 2 > Texture::getMaximumSize()))
+                return std::nullopt;
+
+            // Make the texture 2 times bigger
+            Texture newTexture;
+            if (!newTexture.create(textureSize * 2u))
+            {
+                err() << "Failed to grow texture atlas page" << std::endl;
+                return std::nullopt;
+            }
+
+            newTexture.setSmooth(m_isSmooth);
+            newTexture.update(page.texture);
+            page.texture.swap(newTexture);
+        }
+
+        // We can now create the new row, without going past the bottom of the texture
+        const unsigned int rowHeight = std::min(size.y + size.y / 10, page.texture.getSize().y - page.nextRow);
+        page.rows.emplace_back(page.nextRow, rowHeight);
+        page.nextRow += rowHeight;
+        row = &page.rows.back();
+    }
+
+    // Find the image's rectangle on the selected row
+    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
+
+    // Update the row informations
+    row->width += size.x;
+
+    return rect;
+}
+
+} // namespace sf
@@ -0,0 +1,417 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/Graphics/TextureStreamer.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+#include <ostream>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureStreamerImpl
+{
+std::recursive_mutex isAvailableMutex;
+
+#ifndef SFML_OPENGL_ES
+
+// Check whether the graphics card is done with a staging buffer
+bool isSignaled(void* fence, bool wait)
+{
+    if (!fence)
+        return true;
+
+    GLenum result = GLEXT_GL_WAIT_FAILED;
+    glCheck(result = GLEXT_glClientWaitSync(static_cast<GLEXT_GLsync>(fence),
+                                            GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT,
+                                            wait ? GLEXT_GL_TIMEOUT_IGNORED : 0));
+
+    // A failed wait is considered finished, mapping the buffer will synchronize anyway
+    return result != GLEXT_GL_TIMEOUT_EXPIRED;
+}
+
+
+// Insert a fence after the commands that read from or write to a staging buffer
+void* insertFence()
+{
+    if (!GLEXT_sync)
+        return nullptr;
+
+    GLEXT_GLsync fence = nullptr;
+    glCheck(fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    return fence;
+}
+
+#endif // SFML_OPENGL_ES
+} // namespace TextureStreamerImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureStreamer::TextureStreamer(std::size_t bufferCount) : m_uploadBuffers(std::max<std::size_t>(bufferCount, 1))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::~TextureStreamer()
+{
+    TransientContextLock contextLock;
+
+    for (Buffer& buffer : m_uploadBuffers)
+        destroy(buffer);
+
+    for (Copy& copy : m_copies)
+        destroy(copy.staging);
+
+    for (Buffer& buffer : m_readbackBuffers)
+        destroy(buffer);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::update(Texture& texture, const std::uint8_t* pixels)
+{
+    // Update the whole texture
+    return update(texture, pixels, texture.getSize(), {0, 0});
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::update(Texture& texture, const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest)
+{
+    assert(dest.x + size.x <= texture.m_size.x);
+    assert(dest.y + size.y <= texture.m_size.y);
+
+    if (!pixels || !texture.m_texture)
+        return false;
+
+    if (!isAvailable())
+    {
+        texture.update(pixels, size, dest);
+        return true;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    TransientContextLock contextLock;
+
+    Buffer& staging = m_uploadBuffers[m_nextUpload];
+    m_nextUpload    = (m_nextUpload + 1) % m_uploadBuffers.size();
+
+    if (!staging.buffer)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &staging.buffer));
+
+        if (!staging.buffer)
+        {
+            err() << "Could not update texture asynchronously, failed to generate pixel buffer" << std::endl;
+            return false;
+        }
+    }
+
+    const std::size_t byteCount = static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, staging.buffer));
+
+    // Reuse the storage if the graphics card is known to be done with it,
+    // otherwise orphan it so that the driver hands out fresh memory instead
+    // of waiting for the previous transfer to complete
+    if ((byteCount > staging.capacity) || !staging.fence || !TextureStreamerImpl::isSignaled(staging.fence, false))
+    {
+        staging.capacity = std::max(byteCount, staging.capacity);
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(staging.capacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+    }
+
+    if (staging.fence)
+    {
+        glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(staging.fence)));
+        staging.fence = nullptr;
+    }
+
+    void* destination = nullptr;
+    glCheck(destination = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, GLEXT_GL_WRITE_ONLY));
+
+    if (!destination)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+        err() << "Could not update texture asynchronously, failed to map pixel buffer" << std::endl;
+        return false;
+    }
+
+    std::memcpy(destination, pixels, byteCount);
+
+    GLboolean unmapped = GL_FALSE;
+    glCheck(unmapped = GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER));
+
+    if (unmapped == GL_FALSE)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+        err() << "Could not update texture asynchronously, pixel buffer contents were lost" << std::endl;
+        return false;
+    }
+
+    // With a pixel unpack buffer bound, the pixel pointer is an offset into the buffer
+    texture.uploadPixels(nullptr, size, dest);
+    staging.fence = TextureStreamerImpl::insertFence();
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+    return true;
+
+#else
+
+    return false;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::requestCopy(const Texture& texture)
+{
+    if (!isAvailable() || !texture.m_texture || (m_copies.size() >= m_uploadBuffers.size()))
+        return false;
+
+#ifndef SFML_OPENGL_ES
+
+    TransientContextLock contextLock;
+
+    Copy copy;
+    copy.size          = texture.m_size;
+    copy.actualSize    = texture.m_actualSize;
+    copy.pixelsFlipped = texture.m_pixelsFlipped;
+
+    // Recycle the staging buffer of a previously retrieved copy if possible
+    if (!m_readbackBuffers.empty())
+    {
+        copy.staging = m_readbackBuffers.back();
+        m_readbackBuffers.pop_back();
+    }
+    else
+    {
+        glCheck(GLEXT_glGenBuffers(1, &copy.staging.buffer));
+
+        if (!copy.staging.buffer)
+        {
+            err() << "Could not copy texture asynchronously, failed to generate pixel buffer" << std::endl;
+            return false;
+        }
+    }
+
+    const std::size_t byteCount = static_cast<std::size_t>(copy.actualSize.x) *
+                                  static_cast<std::size_t>(copy.actualSize.y) * 4;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, copy.staging.buffer));
+
+    if (byteCount > copy.staging.capacity)
+    {
+        copy.staging.capacity = byteCount;
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(copy.staging.capacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_READ));
+    }
+
+    {
+        // Make sure that the current texture binding will be preserved
+        priv::TextureSaver save;
+
+        // With a pixel pack buffer bound, the pixel pointer is an offset into the buffer
+        glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+    }
+
+    copy.staging.fence = TextureStreamerImpl::insertFence();
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+    // Submit the commands right away, so that the transfer runs in the
+    // background and is complete by the time the copy gets retrieved
+    glCheck(glFlush());
+
+    m_copies.push_back(copy);
+
+    return true;
+
+#else
+
+    return false;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::retrieveCopy(Image& image, bool wait)
+{
+    if (m_copies.empty())
+        return false;
+
+#ifndef SFML_OPENGL_ES
+
+    TransientContextLock contextLock;
+
+    Copy copy = m_copies.front();
+
+    if (!TextureStreamerImpl::isSignaled(copy.staging.fence, wait))
+        return false;
+
+    m_copies.pop_front();
+
+    if (copy.staging.fence)
+    {
+        glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(copy.staging.fence)));
+        copy.staging.fence = nullptr;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, copy.staging.buffer));
+
+    const void* source = nullptr;
+    glCheck(source = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY));
+
+    if (!source)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+        destroy(copy.staging);
+        err() << "Could not copy texture asynchronously, failed to map pixel buffer" << std::endl;
+        return false;
+    }
+
+    // Copy the useful pixels, the texture may be padded or flipped
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(copy.size.x) * static_cast<std::size_t>(copy.size.y) * 4);
+
+    const auto*   src      = static_cast<const std::uint8_t*>(source);
+    std::uint8_t* dst      = pixels.data();
+    int           srcPitch = static_cast<int>(copy.actualSize.x * 4);
+    unsigned int  dstPitch = copy.size.x * 4;
+
+    // Handle the case where source pixels are flipped vertically
+    if (copy.pixelsFlipped)
+    {
+        src += static_cast<unsigned int>(srcPitch * static_cast<int>((copy.size.y - 1)));
+        srcPitch = -srcPitch;
+    }
+
+    for (unsigned int i = 0; i < copy.size.y; ++i)
+    {
+        std::memcpy(dst, src, dstPitch);
+        src += srcPitch;
+        dst += dstPitch;
+    }
+
+    GLboolean unmapped = GL_FALSE;
+    glCheck(unmapped = GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+    m_readbackBuffers.push_back(copy.staging);
+
+    if (unmapped == GL_FALSE)
+    {
+        err() << "Could not copy texture asynchronously, pixel buffer contents were lost" << std::endl;
+        return false;
+    }
+
+    image.create(copy.size, pixels.data());
+
+    return true;
+
+#else
+
+    static_cast<void>(image);
+    static_cast<void>(wait);
+
+    return false;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getPendingCopyCount() const
+{
+    return m_copies.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::isAvailable()
+{
+    std::scoped_lock lock(TextureStreamerImpl::isAvailableMutex);
+
+    static bool checked   = false;
+    static bool available = false;
+
+    if (!checked)
+    {
+        checked = true;
+
+        TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        available = GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object;
+    }
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::destroy(Buffer& buffer)
+{
+#ifndef SFML_OPENGL_ES
+
+    if (buffer.fence)
+        glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(buffer.fence)));
+
+    if (buffer.buffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &buffer.buffer));
+
+#endif // SFML_OPENGL_ES
+
+    buffer = Buffer();
+}
+
+} // namespace sf
@@ -0,0 +1,395 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CullingGrid.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <ostream>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TileMapImpl
+{
+// Scratch buffer for the vertices of a chunk before they are uploaded to its vertex buffer
+thread_local std::vector<sf::Vertex> vertexScratch;
+} // namespace TileMapImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap(const Texture& tileset, const Vector2u& tileSize, const Vector2u& size, unsigned int chunkSize) :
+m_tileset(&tileset),
+m_tileSize(tileSize),
+m_size(size),
+m_chunkSize(std::max(chunkSize, 1u)),
+m_chunkCount((size.x + m_chunkSize - 1) / m_chunkSize, (size.y + m_chunkSize - 1) / m_chunkSize),
+m_tiles(static_cast<std::size_t>(size.x) * size.y, EmptyTile),
+m_chunks(static_cast<std::size_t>(m_chunkCount.x) * m_chunkCount.y)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTileset(const Texture& tileset)
+{
+    m_tileset = &tileset;
+
+    // The texture coordinates depend on the number of tiles per row of the tileset
+    invalidateChunks(false);
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TileMap::getTileset() const
+{
+    return *m_tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(const Vector2u& cell, TileId tile)
+{
+    assert(cell.x < m_size.x && cell.y < m_size.y && "Cell is out of the map");
+
+    TileId& current = m_tiles[static_cast<std::size_t>(cell.y) * m_size.x + cell.x];
+    if (current == tile)
+        return;
+
+    current = tile;
+    m_chunks[static_cast<std::size_t>(cell.y / m_chunkSize) * m_chunkCount.x + cell.x / m_chunkSize].needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTiles(const TileId* tiles)
+{
+    std::copy(tiles, tiles + m_tiles.size(), m_tiles.begin());
+    invalidateChunks(false);
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileId TileMap::getTile(const Vector2u& cell) const
+{
+    assert(cell.x < m_size.x && cell.y < m_size.y && "Cell is out of the map");
+
+    return m_tiles[static_cast<std::size_t>(cell.y) * m_size.x + cell.x];
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setAnimation(TileId tile, const std::vector<TileId>& frames, Time frameDuration)
+{
+    assert(tile != EmptyTile && "The empty tile cannot be animated");
+
+    auto it = std::find_if(m_animations.begin(),
+                           m_animations.end(),
+                           [tile](const Animation& animation) { return animation.tile == tile; });
+
+    if (frames.empty())
+    {
+        if (it == m_animations.end())
+            return;
+
+        m_animations.erase(it);
+        m_displayedTiles[tile] = tile;
+        m_animatedTiles[tile]  = false;
+    }
+    else
+    {
+        // Grow the indirection table, the tiles that are not animated display themselves
+        if (tile >= m_displayedTiles.size())
+        {
+            const std::size_t oldSize = m_displayedTiles.size();
+            m_displayedTiles.resize(static_cast<std::size_t>(tile) + 1);
+            m_animatedTiles.resize(static_cast<std::size_t>(tile) + 1, false);
+
+            for (std::size_t i = oldSize; i < m_displayedTiles.size(); ++i)
+                m_displayedTiles[i] = static_cast<TileId>(i);
+        }
+
+        if (it == m_animations.end())
+            it = m_animations.insert(m_animations.end(), Animation());
+
+        it->tile          = tile;
+        it->frames        = frames;
+        it->frameDuration = frameDuration;
+        it->elapsed       = Time::Zero;
+        it->frame         = 0;
+
+        m_displayedTiles[tile] = frames[0];
+        m_animatedTiles[tile]  = true;
+    }
+
+    // Chunks need to know again whether they contain animated tiles
+    invalidateChunks(false);
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::update(Time elapsed)
+{
+    bool frameChanged = false;
+
+    for (Animation& animation : m_animations)
+    {
+        if (animation.frameDuration <= Time::Zero)
+            continue;
+
+        const Time loopDuration = animation.frameDuration * static_cast<std::int64_t>(animation.frames.size());
+        animation.elapsed       = (animation.elapsed + elapsed) % loopDuration;
+
+        const auto frame = static_cast<std::size_t>(animation.elapsed.asMicroseconds() /
+                                                    animation.frameDuration.asMicroseconds());
+
+        if (frame != animation.frame)
+        {
+            animation.frame                  = frame;
+            m_displayedTiles[animation.tile] = animation.frames[frame];
+            frameChanged                     = true;
+        }
+    }
+
+    if (frameChanged)
+        invalidateChunks(true);
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileId TileMap::getDisplayedTile(TileId tile) const
+{
+    return (tile < m_displayedTiles.size()) ? m_displayedTiles[tile] : tile;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return FloatRect({0.f, 0.f},
+                     {static_cast<float>(m_size.x * m_tileSize.x), static_cast<float>(m_size.y * m_tileSize.y)});
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, const RenderStates& states) const
+{
+    if (m_chunks.empty() || (m_tileSize.x == 0) || (m_tileSize.y == 0))
+        return;
+
+    RenderStates statesCopy(states);
+
+    statesCopy.transform *= getTransform();
+    statesCopy.texture = m_tileset;
+
+    // Find the range of chunks overlapping the visible area, in the local coordinates of the map
+    const FloatRect area = statesCopy.transform.getInverse().transformRect(
+        CullingGrid::computeVisibleArea(target.getView()));
+
+    const float chunkWidth  = static_cast<float>(m_chunkSize * m_tileSize.x);
+    const float chunkHeight = static_cast<float>(m_chunkSize * m_tileSize.y);
+    const float left        = std::floor(area.left / chunkWidth);
+    const float top         = std::floor(area.top / chunkHeight);
+    const float right       = std::floor((area.left + area.width) / chunkWidth);
+    const float bottom      = std::floor((area.top + area.height) / chunkHeight);
+
+    if ((right < 0.f) || (bottom < 0.f) || (left >= static_cast<float>(m_chunkCount.x)) ||
+        (top >= static_cast<float>(m_chunkCount.y)))
+        return;
+
+    const Vector2u first(static_cast<unsigned int>(std::max(left, 0.f)), static_cast<unsigned int>(std::max(top, 0.f)));
+    const Vector2u last(static_cast<unsigned int>(std::min(right, static_cast<float>(m_chunkCount.x - 1))),
+                        static_cast<unsigned int>(std::min(bottom, static_cast<float>(m_chunkCount.y - 1))));
+
+    // All the chunks share the same indices: two triangles per quad of 4 vertices
+    if (m_indices.empty())
+    {
+        const std::size_t quadCount = static_cast<std::size_t>(m_chunkSize) * m_chunkSize;
+        m_indices.reserve(quadCount * 6);
+
+        for (std::uint32_t i = 0; i < quadCount; ++i)
+        {
+            const std::uint32_t base = i * 4;
+            m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base + 2, base + 1, base + 3});
+        }
+    }
+
+    // Draws recorded to a render queue may happen on a thread without an OpenGL
+    // context (sf::RenderCommandBuffer), they use the vertices of the chunks instead
+    const bool useBuffers = !target.getRenderQueue() && VertexBuffer::isAvailable() && IndexBuffer::isAvailable();
+
+    if (useBuffers && (m_indexBuffer.getIndexCount() == 0))
+    {
+        if (!m_indexBuffer.create(m_indices.size()) || !m_indexBuffer.update(m_indices.data()))
+        {
+            err() << "Failed to create the index buffer of the tile map" << std::endl;
+            return;
+        }
+    }
+
+    for (unsigned int y = first.y; y <= last.y; ++y)
+    {
+        for (unsigned int x = first.x; x <= last.x; ++x)
+        {
+            Chunk& chunk = m_chunks[static_cast<std::size_t>(y) * m_chunkCount.x + x];
+
+            if (chunk.needUpdate || (chunk.inBuffer != useBuffers))
+                updateChunk({x, y}, chunk, useBuffers);
+
+            if (chunk.tileCount == 0)
+                continue;
+
+            if (useBuffers)
+            {
+                target.draw(chunk.buffer, m_indexBuffer, 0, chunk.tileCount * 6, statesCopy);
+            }
+            else
+            {
+                target.draw(chunk.vertices.data(),
+                            chunk.vertices.size(),
+                            m_indices.data(),
+                            chunk.tileCount * 6,
+                            PrimitiveType::Triangles,
+                            statesCopy);
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateChunk(const Vector2u& chunkCell, Chunk& chunk, bool useBuffers) const
+{
+    chunk.needUpdate = false;
+    chunk.inBuffer   = useBuffers;
+    chunk.isAnimated = false;
+    chunk.tileCount  = 0;
+
+    std::vector<Vertex>& vertices = useBuffers ? TileMapImpl::vertexScratch : chunk.vertices;
+    vertices.clear();
+
+    const unsigned int columns = m_tileset->getSize().x / m_tileSize.x;
+    if (columns == 0)
+        return;
+
+    const Vector2u first(chunkCell.x * m_chunkSize, chunkCell.y * m_chunkSize);
+    const Vector2u last(std::min(first.x + m_chunkSize, m_size.x), std::min(first.y + m_chunkSize, m_size.y));
+    const float    width  = static_cast<float>(m_tileSize.x);
+    const float    height = static_cast<float>(m_tileSize.y);
+
+    for (unsigned int y = first.y; y < last.y; ++y)
+    {
+        for (unsigned int x = first.x; x < last.x; ++x)
+        {
+            TileId tile = m_tiles[static_cast<std::size_t>(y) * m_size.x + x];
+            if (tile == EmptyTile)
+                continue;
+
+            // Animated tiles display another tile of the tileset
+            if ((tile < m_animatedTiles.size()) && m_animatedTiles[tile])
+            {
+                chunk.isAnimated = true;
+                tile             = m_displayedTiles[tile];
+            }
+
+            const Vector2f position(static_cast<float>(x) * width, static_cast<float>(y) * height);
+            const Vector2f texCoords(static_cast<float>(tile % columns) * width,
+                                     static_cast<float>(tile / columns) * height);
+
+            // Same corners as sf::Sprite
+            vertices.emplace_back(position, texCoords);
+            vertices.emplace_back(position + Vector2f(0.f, height), texCoords + Vector2f(0.f, height));
+            vertices.emplace_back(position + Vector2f(width, 0.f), texCoords + Vector2f(width, 0.f));
+            vertices.emplace_back(position + Vector2f(width, height), texCoords + Vector2f(width, height));
+
+            ++chunk.tileCount;
+        }
+    }
+
+    if (!useBuffers || (chunk.tileCount == 0))
+        return;
+
+    // Static buffers are only reallocated when the chunk gets more tiles than it ever had
+    if ((chunk.buffer.getVertexCount() < vertices.size()) && !chunk.buffer.create(vertices.size()))
+    {
+        err() << "Failed to create the vertex buffer of a tile map chunk" << std::endl;
+        chunk.tileCount = 0;
+        return;
+    }
+
+    if (!chunk.buffer.update(vertices.data(), vertices.size(), 0))
+    {
+        err() << "Failed to update the vertex buffer of a tile map chunk" << std::endl;
+        chunk.tileCount = 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::invalidateChunks(bool animatedOnly)
+{
+    for (Chunk& chunk : m_chunks)
+    {
+        if (!animatedOnly || chunk.isAnimated)
+            chunk.needUpdate = true;
+    }
+}
+
+} // namespace sf
@@ -26,10 +26,124 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Angle.hpp>
 
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_TRANSFORM_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SFML_TRANSFORM_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TransformImpl
+{
+// Access the position of the elements of the arrays to transform
+sf::Vector2f& positionOf(sf::Vector2f& point)
+{
+    return point;
+}
+
+const sf::Vector2f& positionOf(const sf::Vector2f& point)
+{
+    return point;
+}
+
+sf::Vector2f& positionOf(sf::Vertex& vertex)
+{
+    return vertex.position;
+}
+
+const sf::Vector2f& positionOf(const sf::Vertex& vertex)
+{
+    return vertex.position;
+}
+
+// Copy the attributes that are not transformed
+void copyAttributes(const sf::Vector2f&, sf::Vector2f&)
+{
+}
+
+void copyAttributes(const sf::Vertex& source, sf::Vertex& destination)
+{
+    destination.color     = source.color;
+    destination.texCoords = source.texCoords;
+}
+
+// Transform the positions of an array of points or vertices with a 2x3 affine matrix
+template <typename T>
+void transformPositions(const float* matrix, const T* input, std::size_t count, T* output)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_TRANSFORM_SSE2)
+
+    // Two points per iteration: (x0, x0, x1, x1) * (a, d, a, d) + (y0, y0, y1, y1) * (b, e, b, e) + (c, f, c, f)
+    const __m128 xAxis       = _mm_setr_ps(matrix[0], matrix[3], matrix[0], matrix[3]);
+    const __m128 yAxis       = _mm_setr_ps(matrix[1], matrix[4], matrix[1], matrix[4]);
+    const __m128 translation = _mm_setr_ps(matrix[2], matrix[5], matrix[2], matrix[5]);
+
+    for (; i + 1 < count; i += 2)
+    {
+        __m128 points = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&positionOf(input[i])));
+        points        = _mm_loadh_pi(points, reinterpret_cast<const __m64*>(&positionOf(input[i + 1])));
+
+        const __m128 xs     = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 ys     = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xAxis), _mm_mul_ps(ys, yAxis)), translation);
+
+        copyAttributes(input[i], output[i]);
+        copyAttributes(input[i + 1], output[i + 1]);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&positionOf(output[i])), result);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&positionOf(output[i + 1])), result);
+    }
+
+#elif defined(SFML_TRANSFORM_NEON)
+
+    const float       xAxisData[]       = {matrix[0], matrix[3], matrix[0], matrix[3]};
+    const float       yAxisData[]       = {matrix[1], matrix[4], matrix[1], matrix[4]};
+    const float       translationData[] = {matrix[2], matrix[5], matrix[2], matrix[5]};
+    const float32x4_t xAxis             = vld1q_f32(xAxisData);
+    const float32x4_t yAxis             = vld1q_f32(yAxisData);
+    const float32x4_t translation       = vld1q_f32(translationData);
+
+    for (; i + 1 < count; i += 2)
+    {
+        const float32x2_t first  = vld1_f32(&positionOf(input[i]).x);
+        const float32x2_t second = vld1_f32(&positionOf(input[i + 1]).x);
+
+        const float32x4_t xs     = vcombine_f32(vdup_lane_f32(first, 0), vdup_lane_f32(second, 0));
+        const float32x4_t ys     = vcombine_f32(vdup_lane_f32(first, 1), vdup_lane_f32(second, 1));
+        const float32x4_t result = vmlaq_f32(vmlaq_f32(translation, xs, xAxis), ys, yAxis);
+
+        copyAttributes(input[i], output[i]);
+        copyAttributes(input[i + 1], output[i + 1]);
+        vst1_f32(&positionOf(output[i]).x, vget_low_f32(result));
+        vst1_f32(&positionOf(output[i + 1]).x, vget_high_f32(result));
+    }
+
+#endif
+
+    // Remaining point, or all of them without SIMD
+    for (; i < count; ++i)
+    {
+        const sf::Vector2f point = positionOf(input[i]);
+
+        copyAttributes(input[i], output[i]);
+        positionOf(output[i]) = {matrix[0] * point.x + matrix[1] * point.y + matrix[2],
+                                 matrix[3] * point.x + matrix[4] * point.y + matrix[5]};
+    }
+}
+} // namespace TransformImpl
+} // namespace
+
 
 namespace sf
 {
@@ -66,4 +180,18 @@ Transform& Transform::rotate(Angle angle, const Vector2f& center)
     return combine(rotation);
 }
 
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* points, std::size_t count, Vector2f* result) const
+{
+    TransformImpl::transformPositions(m_matrix, points, count, result);
+}
+
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vertex* vertices, std::size_t count, Vertex* result) const
+{
+    TransformImpl::transformPositions(m_matrix, vertices, count, result);
+}
+
 } // namespace sf
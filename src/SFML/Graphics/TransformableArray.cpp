@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/TransformableArray.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TransformableArrayImpl
+{
+// Number of objects processed at a time, so that the intermediate arrays stay in the L1 cache
+constexpr std::size_t blockSize = 256;
+
+// Coefficients of the first two rows of the combined transforms of a block of objects,
+// stored as separate arrays so that the loops computing them can be vectorized
+struct AffineBlock
+{
+    float cosine[blockSize];
+    float sine[blockSize];
+    float a[blockSize], b[blockSize], c[blockSize];
+    float d[blockSize], e[blockSize], f[blockSize];
+};
+
+// Compute the coefficients of a block of objects, same formula as sf::Transformable
+void computeAffineBlock(const sf::Vector2f* positions,
+                        const sf::Angle*    rotations,
+                        const sf::Vector2f* scales,
+                        const sf::Vector2f* origins,
+                        std::size_t         count,
+                        AffineBlock&        block)
+{
+    // The trigonometry is the expensive part, it gets a loop of its own
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float angle = -rotations[i].asRadians();
+        block.cosine[i]   = std::cos(angle);
+        block.sine[i]     = std::sin(angle);
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float sxc = scales[i].x * block.cosine[i];
+        const float syc = scales[i].y * block.cosine[i];
+        const float sxs = scales[i].x * block.sine[i];
+        const float sys = scales[i].y * block.sine[i];
+
+        block.a[i] = sxc;
+        block.b[i] = sys;
+        block.c[i] = -origins[i].x * sxc - origins[i].y * sys + positions[i].x;
+        block.d[i] = -sxs;
+        block.e[i] = syc;
+        block.f[i] = origins[i].x * sxs - origins[i].y * syc + positions[i].y;
+    }
+}
+} // namespace TransformableArrayImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TransformableArray::TransformableArray() = default;
+
+
+////////////////////////////////////////////////////////////
+TransformableArray::TransformableArray(std::size_t count)
+{
+    resize(count);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformableArray::resize(std::size_t count)
+{
+    m_positions.resize(count);
+    m_rotations.resize(count);
+    m_scales.resize(count, Vector2f(1, 1));
+    m_origins.resize(count);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformableArray::getSize() const
+{
+    return m_positions.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformableArray::add(const Vector2f& position,
+                                    Angle           rotation,
+                                    const Vector2f& scale,
+                                    const Vector2f& origin)
+{
+    m_positions.push_back(position);
+    m_rotations.push_back(rotation);
+    m_scales.push_back(scale);
+    m_origins.push_back(origin);
+
+    return m_positions.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformableArray::swapRemove(std::size_t index)
+{
+    assert(index < m_positions.size() && "Index is out of bounds");
+
+    m_positions[index] = m_positions.back();
+    m_rotations[index] = m_rotations.back();
+    m_scales[index]    = m_scales.back();
+    m_origins[index]   = m_origins.back();
+
+    m_positions.pop_back();
+    m_rotations.pop_back();
+    m_scales.pop_back();
+    m_origins.pop_back();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f* TransformableArray::getPositions()
+{
+    return m_positions.data();
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f* TransformableArray::getPositions() const
+{
+    return m_positions.data();
+}
+
+
+////////////////////////////////////////////////////////////
+Angle* TransformableArray::getRotations()
+{
+    return m_rotations.data();
+}
+
+
+////////////////////////////////////////////////////////////
+const Angle* TransformableArray::getRotations() const
+{
+    return m_rotations.data();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f* TransformableArray::getScales()
+{
+    return m_scales.data();
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f* TransformableArray::getScales() const
+{
+    return m_scales.data();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f* TransformableArray::getOrigins()
+{
+    return m_origins.data();
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f* TransformableArray::getOrigins() const
+{
+    return m_origins.data();
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformableArray::computeTransforms(std::size_t first, std::size_t count, Transform* transforms) const
+{
+    assert(first + count <= m_positions.size() && "Range is out of bounds");
+
+    TransformableArrayImpl::AffineBlock block;
+
+    for (std::size_t done = 0; done < count; done += TransformableArrayImpl::blockSize)
+    {
+        const std::size_t index = first + done;
+        const std::size_t size  = std::min(count - done, TransformableArrayImpl::blockSize);
+
+        TransformableArrayImpl::computeAffineBlock(&m_positions[index],
+                                                   &m_rotations[index],
+                                                   &m_scales[index],
+                                                   &m_origins[index],
+                                                   size,
+                                                   block);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            // clang-format off
+            transforms[done + i] = Transform(block.a[i], block.b[i], block.c[i],
+                                             block.d[i], block.e[i], block.f[i],
+                                             0.f,        0.f,        1.f);
+            // clang-format on
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformableArray::computeQuads(std::size_t    first,
+                                      std::size_t    count,
+                                      const IntRect* textureRects,
+                                      const Color*   colors,
+                                      Vertex*        vertices) const
+{
+    assert(first + count <= m_positions.size() && "Range is out of bounds");
+
+    TransformableArrayImpl::AffineBlock block;
+
+    for (std::size_t done = 0; done < count; done += TransformableArrayImpl::blockSize)
+    {
+        const std::size_t index = first + done;
+        const std::size_t size  = std::min(count - done, TransformableArrayImpl::blockSize);
+
+        TransformableArrayImpl::computeAffineBlock(&m_positions[index],
+                                                   &m_rotations[index],
+                                                   &m_scales[index],
+                                                   &m_origins[index],
+                                                   size,
+                                                   block);
+
+        for (std::size_t j = 0; j < size; ++j)
+        {
+            const std::size_t i = done + j;
+
+            // The local quad is (0, 0, width, height), like sf::Sprite: its corners are the translation
+            // plus combinations of the transformed axes
+            const FloatRect rect(textureRects[i]);
+            const float     width  = std::abs(rect.width);
+            const float     height = std::abs(rect.height);
+
+            const Vector2f topLeft(block.c[j], block.f[j]);
+            const Vector2f right(block.a[j] * width, block.d[j] * width);
+            const Vector2f down(block.b[j] * height, block.e[j] * height);
+
+            const float left   = rect.left;
+            const float top    = rect.top;
+            const float tright = left + rect.width;
+            const float bottom = top + rect.height;
+
+            const Color color = colors ? colors[i] : Color::White;
+
+            // Same corners as sf::Sprite, the two triangles of the quad are made by the shared quad indices
+            Vertex* quad = vertices + i * 4;
+            quad[0]      = Vertex(topLeft, color, {left, top});
+            quad[1]      = Vertex(topLeft + down, color, {left, bottom});
+            quad[2]      = Vertex(topLeft + right, color, {tright, top});
+            quad[3]      = Vertex(topLeft + right + down, color, {tright, bottom});
+        }
+    }
+}
+
+} // namespace sf
@@ -177,18 +177,22 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
     // Check if we need to resize or orphan the buffer
     if (vertexCount >= m_size)
     {
+        // The whole content is replaced (offset is 0 here), so the new storage can be
+        // filled directly instead of being allocated and then updated in a second call
         glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
                                    static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                   nullptr,
+                                   vertices,
                                    VertexBufferImpl::usageToGlEnum(m_usage)));
 
         m_size = vertexCount;
     }
-
-    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                  vertices));
+    else
+    {
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(sizeof(Vertex) * offset),
+                                      static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                      vertices));
+    }
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
@@ -0,0 +1,230 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexStream.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace VertexStreamImpl
+{
+// Minimum capacity of the buffer, in vertices
+constexpr std::size_t minimumCapacity = 16384;
+
+// Persistent mapping requires immutable storage, and fences to know when a region can be overwritten
+bool isPersistentMappingAvailable()
+{
+#ifdef SFML_OPENGL_ES
+    return false;
+#else
+    return GLEXT_buffer_storage && GLEXT_sync;
+#endif
+}
+
+#ifndef SFML_OPENGL_ES
+
+// Block until the GPU is done reading the region guarded by a fence, then destroy the fence
+void waitFence(void*& fence)
+{
+    if (!fence)
+        return;
+
+    glCheck(GLEXT_glClientWaitSync(static_cast<GLEXT_GLsync>(fence),
+                                   GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT,
+                                   GLEXT_GL_TIMEOUT_IGNORED));
+    glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(fence)));
+    fence = nullptr;
+}
+
+#endif
+} // namespace VertexStreamImpl
+} // namespace
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+VertexStream::~VertexStream()
+{
+    TransientContextLock lock;
+
+    release();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexStream::write(const Vertex* vertices, std::size_t vertexCount)
+{
+    // Every region must be able to hold the largest draw
+    if (!m_buffer || (vertexCount > m_capacity / RegionCount))
+        allocate(std::max({vertexCount * RegionCount, m_capacity * 2, VertexStreamImpl::minimumCapacity}));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+#ifndef SFML_OPENGL_ES
+
+    if (m_mapping)
+    {
+        // The current region is the one holding the last written vertex: a write
+        // position sitting on a boundary means that the region before it is full
+        const std::size_t regionSize = m_capacity / RegionCount;
+        const std::size_t region     = (m_offset > 0) ? (m_offset - 1) / regionSize : 0;
+        const std::size_t regionEnd  = (region + 1) * regionSize;
+
+        // Draws never straddle two regions: when the current one is full, protect
+        // it with a fence and move on to the next one once the GPU is done with it
+        if (m_offset + vertexCount > regionEnd)
+        {
+            GLEXT_GLsync fence = nullptr;
+            glCheck(fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+            m_fences[region] = fence;
+
+            const std::size_t next = (region + 1) % RegionCount;
+            VertexStreamImpl::waitFence(m_fences[next]);
+            m_offset = next * regionSize;
+        }
+
+        // The mapping is coherent, no flush is needed before drawing
+        std::memcpy(m_mapping + m_offset, vertices, sizeof(Vertex) * vertexCount);
+
+        const std::size_t first = m_offset;
+        m_offset += vertexCount;
+        return first;
+    }
+
+#endif
+
+    if (m_offset + vertexCount > m_capacity)
+    {
+        // Orphan the storage, the driver hands out fresh memory instead of waiting for pending draws
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_capacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+        m_offset = 0;
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                  static_cast<GLintptrARB>(sizeof(Vertex) * m_offset),
+                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                  vertices));
+
+    const std::size_t first = m_offset;
+    m_offset += vertexCount;
+    return first;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VertexStream::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexStream::allocate(std::size_t capacity)
+{
+    // Create the new buffer before destroying the old one, so that the handle
+    // is guaranteed to change and users know that they must point to it again
+    unsigned int buffer = 0;
+    glCheck(GLEXT_glGenBuffers(1, &buffer));
+
+    release();
+
+    m_buffer = buffer;
+
+    // Keep regions aligned on whole vertices
+    m_capacity = capacity - capacity % RegionCount;
+    m_offset   = 0;
+
+    const auto size = static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_capacity);
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+#ifndef SFML_OPENGL_ES
+
+    if (VertexStreamImpl::isPersistentMappingAvailable())
+    {
+        const GLbitfield flags = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_PERSISTENT_BIT | GLEXT_GL_MAP_COHERENT_BIT;
+
+        void* mapping = nullptr;
+        glCheck(GLEXT_glBufferStorage(GLEXT_GL_ARRAY_BUFFER, size, nullptr, flags));
+        glCheck(mapping = GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER, 0, size, flags));
+        m_mapping = static_cast<Vertex*>(mapping);
+
+        if (m_mapping)
+            return;
+
+        // Immutable storage cannot be orphaned, start over with a regular buffer
+        glCheck(GLEXT_glGenBuffers(1, &buffer));
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+        m_buffer = buffer;
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    }
+
+#endif
+
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER, size, nullptr, GLEXT_GL_STREAM_DRAW));
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexStream::release()
+{
+#ifndef SFML_OPENGL_ES
+
+    for (void*& fence : m_fences)
+    {
+        if (fence)
+            glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(fence)));
+
+        fence = nullptr;
+    }
+
+#endif
+
+    // Deleting the buffer also unmaps it; the driver keeps the storage alive until pending draws are done
+    if (m_buffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+
+    m_buffer  = 0;
+    m_mapping = nullptr;
+}
+
+} // namespace priv
+
+} // namespace sf
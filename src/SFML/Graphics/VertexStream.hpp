@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <cstddef>
+
+
+namespace sf
+{
+class Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring buffer receiving the vertices of immediate-mode draws
+///
+/// Vertices are appended to a single vertex buffer object
+/// instead of being read by the driver from client memory
+/// at each draw. When ARB_buffer_storage and ARB_sync are
+/// available, the buffer is mapped persistently and split
+/// into regions guarded by fences, so that writing never
+/// stalls on the GPU unless it falls behind by a whole ring.
+/// Otherwise the storage is orphaned whenever the buffer is
+/// full and the vertices are uploaded with glBufferSubData.
+///
+////////////////////////////////////////////////////////////
+class VertexStream : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The buffer is created on the first write.
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexStream() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~VertexStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexStream(const VertexStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexStream& operator=(const VertexStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append vertices to the buffer
+    ///
+    /// A context must be active. The buffer is left bound to
+    /// GL_ARRAY_BUFFER, so that the caller can point the vertex
+    /// attributes to it.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    ///
+    /// \return Index of the first written vertex in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t write(const Vertex* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenGL handle of the buffer
+    ///
+    /// The handle changes whenever the buffer is recreated
+    /// to grow, vertex attributes must then be pointed to
+    /// the new buffer.
+    ///
+    /// \return OpenGL handle of the buffer, or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getNativeHandle() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief (Re)create the buffer with a new capacity
+    ///
+    /// \param capacity Capacity of the buffer, in vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void allocate(std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the buffer and the pending fences
+    ///
+    ////////////////////////////////////////////////////////////
+    void release();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t RegionCount{3}; //!< Number of regions of the persistent ring
+
+    unsigned int                   m_buffer{0};        //!< OpenGL handle of the buffer
+    std::size_t                    m_capacity{0};      //!< Capacity of the buffer, in vertices
+    std::size_t                    m_offset{0};        //!< Write position, in vertices
+    Vertex*                        m_mapping{nullptr}; //!< Persistent mapping of the buffer, null when orphaning
+    std::array<void*, RegionCount> m_fences{};         //!< Fences guarding the regions of the persistent ring
+};
+
+} // namespace priv
+
+} // namespace sf
@@ -30,6 +30,7 @@
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/TcpSocket.hpp>
 #include <SFML/System/Err.hpp>
+#include <SFML/System/Trace.hpp>
 
 #include <algorithm>
 #include <cstring>
@@ -271,6 +272,8 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& received)
 {
+    SFML_TRACE_ZONE("TcpSocket::receive");
+
     // First clear the variables to fill
     received = 0;
 
@@ -367,6 +370,8 @@ Socket::Status TcpSocket::send(Packet& packet)
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::receive(Packet& packet)
 {
+    SFML_TRACE_ZONE("TcpSocket::receive(Packet)");
+
     // First clear the variables to fill
     packet.clear();
 
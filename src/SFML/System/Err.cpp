@@ -27,84 +27,495 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
 #include <streambuf>
+#include <thread>
+#include <utility>
+#include <vector>
 
 
 namespace
 {
-// This class will be used as the default streambuf of sf::Err,
-// it outputs to stderr by default (to keep the default behavior)
-class DefaultErrStreamBuf : public std::streambuf
+using Clock = std::chrono::steady_clock;
+
+// Identical messages are delivered at most once per window
+constexpr Clock::duration deduplicationWindow = std::chrono::seconds(1);
+
+// Messages beyond this number wait for the sink are dropped
+constexpr std::size_t queueCapacity = 1024;
+
+// The delivery thread stops after being idle for this long, it is restarted on demand
+constexpr Clock::duration idleTimeout = std::chrono::seconds(2);
+
+constexpr std::size_t levelCount = 3;
+
+
+////////////////////////////////////////////////////////////
+// State of the log, shared by all the threads and protected by its mutex
+class LogState
 {
 public:
-    DefaultErrStreamBuf()
+    LogState() : m_sink(sf::Log::writeToStandardError)
     {
-        // Allocate the write buffer
-        constexpr int size   = 64;
-        char*         buffer = new char[size];
-        setp(buffer, buffer + size);
     }
 
-    ~DefaultErrStreamBuf() override
+    ~LogState()
     {
-        // Synchronize
-        sync();
+        std::unique_lock lock(m_mutex);
+
+        // No thread is started here: creating or joining a new thread during static
+        // destruction can deadlock (on Windows, exiting threads need the loader lock)
+        m_shutdown = true;
+        m_wakeUp.notify_all();
+
+        if (m_running)
+        {
+            lock.unlock();
+            m_thread.join();
+            lock.lock();
+        }
+        else if (m_thread.joinable())
+        {
+            // The previous thread exited without touching the state again
+            m_thread.detach();
+        }
+
+        // Deliver what is left before the program exits, on the destroying thread
+        flushRepeats();
+        if (!m_queue.empty())
+        {
+            std::vector<sf::Log::Record> batch;
+            deliver(lock, batch);
+        }
+    }
+
+    void submit(sf::Log::Level level, std::string&& message)
+    {
+        std::scoped_lock lock(m_mutex);
+
+        if (!m_sink)
+            return;
+
+        // Count the repetitions of the last message instead of queueing them,
+        // the delivery thread sends their number when the window elapses
+        const Clock::time_point now = Clock::now();
+        if (m_hasLast && (level == m_last.level) && (message == m_last.message) &&
+            (now < m_lastDelivery + deduplicationWindow))
+        {
+            if (m_repeatCount++ == 0)
+            {
+                m_repeatTime = std::chrono::system_clock::now();
+                m_wakeUp.notify_all();
+                start();
+            }
 
-        // Delete the write buffer
-        delete[] pbase();
+            return;
+        }
+
+        flushRepeats();
+
+        m_last         = {level, std::move(message), std::chrono::system_clock::now(), 1};
+        m_hasLast      = true;
+        m_lastDelivery = now;
+        push(sf::Log::Record(m_last));
+        start();
+    }
+
+    void setSink(sf::Log::Sink&& sink)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_sink = std::move(sink);
+    }
+
+    bool hasSink()
+    {
+        std::scoped_lock lock(m_mutex);
+        return static_cast<bool>(m_sink);
+    }
+
+    void flush()
+    {
+        std::unique_lock lock(m_mutex);
+
+        flushRepeats();
+        if (!m_queue.empty())
+            start();
+
+        m_idle.wait(lock, [this] { return m_queue.empty() && !m_busy; });
     }
 
 private:
-    int overflow(int character) override
+    // Queue the repetitions of the last message, if any
+    void flushRepeats()
     {
-        if ((character != EOF) && (pptr() != epptr()))
+        if (m_repeatCount == 0)
+            return;
+
+        push({m_last.level, m_last.message, m_repeatTime, m_repeatCount});
+        m_repeatCount  = 0;
+        m_lastDelivery = Clock::now();
+    }
+
+    void push(sf::Log::Record&& record)
+    {
+        if (m_queue.size() < queueCapacity)
+            m_queue.push_back(std::move(record));
+        else
+            ++m_dropped;
+
+        m_wakeUp.notify_all();
+    }
+
+    // Start the delivery thread if it is not running
+    void start()
+    {
+        if (m_running || m_shutdown)
+            return;
+
+        // The previous thread exited without touching the state again, joining it can't block
+        if (m_thread.joinable())
+            m_thread.join();
+
+        m_running = true;
+        m_thread  = std::thread(&LogState::run, this);
+    }
+
+    // Deliver the queued messages, the lock is released while the sink is called
+    void deliver(std::unique_lock<std::mutex>& lock, std::vector<sf::Log::Record>& batch)
+    {
+        batch.assign(std::make_move_iterator(m_queue.begin()), std::make_move_iterator(m_queue.end()));
+        m_queue.clear();
+
+        const std::size_t   dropped = std::exchange(m_dropped, 0);
+        const sf::Log::Sink sink    = m_sink;
+        m_busy                      = true;
+
+        // Call the sink without holding the lock, so that writing to sf::err never waits for it
+        lock.unlock();
+
+        if (sink)
         {
-            // Valid character
-            return sputc(static_cast<char>(character));
+            for (const sf::Log::Record& record : batch)
+                sink(record);
+
+            if (dropped > 0)
+                sink({sf::Log::Level::Warning,
+                      std::to_string(dropped) + " messages were dropped because the log queue was full",
+                      std::chrono::system_clock::now(),
+                      1});
         }
-        else if (character != EOF)
+
+        batch.clear();
+        lock.lock();
+
+        m_busy = false;
+        m_idle.notify_all();
+    }
+
+    void run()
+    {
+        std::unique_lock             lock(m_mutex);
+        std::vector<sf::Log::Record> batch;
+
+        for (;;)
         {
-            // Not enough space in the buffer: synchronize output and try again
-            sync();
-            return overflow(character);
+            if (!m_queue.empty())
+            {
+                deliver(lock, batch);
+                continue;
+            }
+
+            // The destructor delivers the repetitions that are left
+            if (m_shutdown)
+                break;
+
+            // Deliver the repetitions of the last message once its window has elapsed
+            if (m_repeatCount > 0)
+            {
+                const Clock::time_point deadline = m_lastDelivery + deduplicationWindow;
+
+                if (Clock::now() >= deadline)
+                    flushRepeats();
+                else
+                    m_wakeUp.wait_until(lock, deadline);
+
+                continue;
+            }
+
+            // Stop the thread when there has been nothing to do for a while
+            if ((m_wakeUp.wait_for(lock, idleTimeout) == std::cv_status::timeout) && m_queue.empty() &&
+                (m_repeatCount == 0))
+                break;
         }
-        else
+
+        m_running = false;
+    }
+
+    std::mutex                            m_mutex;           // Protects all the other members
+    std::condition_variable               m_wakeUp;          // Notified when there is something to deliver
+    std::condition_variable               m_idle;            // Notified when a batch has been delivered
+    sf::Log::Sink                         m_sink;            // Function receiving the messages
+    std::deque<sf::Log::Record>           m_queue;           // Messages waiting for the delivery thread
+    std::size_t                           m_dropped{0};      // Number of messages dropped since the last delivery
+    sf::Log::Record                       m_last;            // Last message queued
+    bool                                  m_hasLast{false};  // Has a message been queued yet?
+    Clock::time_point                     m_lastDelivery;    // Time at which the last message was queued
+    std::size_t                           m_repeatCount{0};  // Number of repetitions of the last message not queued yet
+    std::chrono::system_clock::time_point m_repeatTime;      // Time of the first of these repetitions
+    std::thread                           m_thread;          // Delivery thread
+    bool                                  m_running{false};  // Is the delivery thread running?
+    bool                                  m_busy{false};     // Is the delivery thread calling the sink?
+    bool                                  m_shutdown{false}; // Must the delivery thread stop?
+};
+
+
+////////////////////////////////////////////////////////////
+LogState& getLogState()
+{
+    static LogState state;
+    return state;
+}
+
+
+////////////////////////////////////////////////////////////
+// Lines being written by a thread, one per severity. Each thread builds its own
+// lines, so that the messages of concurrent threads are not mixed.
+class ThreadLines;
+
+// Lines of the calling thread, or null if they were not created yet or are destroyed
+thread_local ThreadLines* threadLines = nullptr;
+
+// Have the lines of the calling thread been destroyed?
+thread_local bool threadLinesDestroyed = false;
+
+class ThreadLines
+{
+public:
+    ThreadLines()
+    {
+        threadLines = this;
+    }
+
+    ~ThreadLines()
+    {
+        // Send the pending parts of lines when the thread exits
+        threadLines          = nullptr;
+        threadLinesDestroyed = true;
+
+        for (std::size_t i = 0; i < levelCount; ++i)
         {
-            // Invalid character: synchronize output
-            return sync();
+            if (!m_lines[i].empty())
+                getLogState().submit(static_cast<sf::Log::Level>(i), std::move(m_lines[i]));
         }
     }
 
-    int sync() override
+    std::string& operator[](sf::Log::Level level)
+    {
+        return m_lines[static_cast<std::size_t>(level)];
+    }
+
+private:
+    std::string m_lines[levelCount]; // Pending line of each severity
+};
+
+
+////////////////////////////////////////////////////////////
+// Get the lines of the calling thread, or null if the thread is exiting
+ThreadLines* getThreadLines()
+{
+    if (threadLinesDestroyed)
+        return nullptr;
+
+    thread_local ThreadLines lines;
+    return &lines;
+}
+
+
+////////////////////////////////////////////////////////////
+// This class will be used as the streambuf of sf::err,
+// it turns each line written to the stream into a log message
+class ErrStreamBuf : public std::streambuf
+{
+public:
+    explicit ErrStreamBuf(sf::Log::Level level) : m_level(level)
+    {
+        // Make sure that the log state outlives the stream buffers, which flush it when they are destroyed
+        getLogState();
+    }
+
+    ~ErrStreamBuf() override
+    {
+        // Synchronize, only if the lines of the calling thread still exist: at
+        // static destruction, the thread-local objects are already destroyed
+        sync();
+    }
+
+private:
+    std::streamsize xsputn(const char* characters, std::streamsize count) override
     {
-        // Check if there is something into the write buffer
-        if (pbase() != pptr())
+        // A thread that is exiting sends the parts of lines it writes as they are
+        ThreadLines*      lines = getThreadLines();
+        std::string       orphan;
+        std::string&      line = lines ? (*lines)[m_level] : orphan;
+        const char* const end  = characters + count;
+
+        while (characters != end)
         {
-            // Print the contents of the write buffer into the standard error output
-            auto size = static_cast<std::size_t>(pptr() - pbase());
-            fwrite(pbase(), 1, size, stderr);
+            const char* newline = std::find(characters, end, '\n');
+            line.append(characters, newline);
 
-            // Reset the pointer position to the beginning of the write buffer
-            setp(pbase(), epptr());
+            if (newline == end)
+                break;
+
+            // Complete line: it becomes a message
+            getLogState().submit(m_level, std::move(line));
+            line.clear();
+            characters = newline + 1;
+        }
+
+        if (!orphan.empty())
+            getLogState().submit(m_level, std::move(orphan));
+
+        return count;
+    }
+
+    int overflow(int character) override
+    {
+        if (character == EOF)
+            return sync();
+
+        const char value = static_cast<char>(character);
+        xsputn(&value, 1);
+        return character;
+    }
+
+    int sync() override
+    {
+        // Send the pending part of the line, if any, as a message
+        if (threadLines)
+        {
+            std::string& line = (*threadLines)[m_level];
+            if (!line.empty())
+            {
+                getLogState().submit(m_level, std::move(line));
+                line.clear();
+            }
         }
 
         return 0;
     }
+
+    sf::Log::Level m_level; // Severity of the messages written to the buffer
 };
+
+
+////////////////////////////////////////////////////////////
+// Streams of each severity, and the minimum severity of the delivered messages
+struct ErrStreams
+{
+    ErrStreams()
+    {
+        for (std::size_t i = 0; i < levelCount; ++i)
+        {
+            buffers[i] = std::make_unique<ErrStreamBuf>(static_cast<sf::Log::Level>(i));
+            streams[i] = std::make_unique<std::ostream>(buffers[i].get());
+        }
+    }
+
+    // Put the streams whose messages are discarded in a failed state, so that writing to them does nothing
+    void update(bool enabled)
+    {
+        for (std::size_t i = 0; i < levelCount; ++i)
+        {
+            if (enabled && (static_cast<sf::Log::Level>(i) >= minimumLevel))
+                streams[i]->clear();
+            else
+                streams[i]->setstate(std::ios::badbit);
+        }
+    }
+
+    std::unique_ptr<ErrStreamBuf> buffers[levelCount];
+    std::unique_ptr<std::ostream> streams[levelCount];
+    sf::Log::Level                minimumLevel{sf::Log::Level::Info};
+    std::mutex                    mutex; // Protects the state of the streams when the settings change
+};
+
+
+////////////////////////////////////////////////////////////
+ErrStreams& getErrStreams()
+{
+    static ErrStreams streams;
+    return streams;
+}
 } // namespace
 
 namespace sf
 {
+namespace Log
+{
 ////////////////////////////////////////////////////////////
-std::ostream& err()
+void writeToStandardError(const Record& record)
+{
+    if (record.count > 1)
+        std::fprintf(stderr, "%s (repeated %zu times)\n", record.message.c_str(), record.count);
+    else
+        std::fprintf(stderr, "%s\n", record.message.c_str());
+}
+
+
+////////////////////////////////////////////////////////////
+void setSink(Sink sink)
 {
-    static DefaultErrStreamBuf buffer;
-    static std::ostream        stream(&buffer);
+    ErrStreams&      streams = getErrStreams();
+    std::scoped_lock lock(streams.mutex);
 
-    return stream;
+    const bool enabled = static_cast<bool>(sink);
+    getLogState().setSink(std::move(sink));
+    streams.update(enabled);
 }
 
 
+////////////////////////////////////////////////////////////
+void setMinimumLevel(Level level)
+{
+    ErrStreams&      streams = getErrStreams();
+    std::scoped_lock lock(streams.mutex);
+
+    streams.minimumLevel = level;
+    streams.update(getLogState().hasSink());
+}
+
+
+////////////////////////////////////////////////////////////
+void flush()
+{
+    // Send the pending line of the calling thread first
+    for (std::size_t i = 0; i < levelCount; ++i)
+        err(static_cast<Level>(i)).flush();
+
+    getLogState().flush();
+}
+} // namespace Log
+
+
+////////////////////////////////////////////////////////////
+std::ostream& err()
+{
+    return err(Log::Level::Error);
+}
+
+
+////////////////////////////////////////////////////////////
+std::ostream& err(Log::Level level)
+{
+    return *getErrStreams().streams[static_cast<std::size_t>(level)];
+}
+
 } // namespace sf
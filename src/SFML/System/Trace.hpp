@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Record the time spent in the enclosing scope
+///
+/// \a name must be a string literal, or at least outlive
+/// the flush of the event (see sf::Tracing). Expands to
+/// nothing unless SFML_ENABLE_TRACING is defined.
+///
+////////////////////////////////////////////////////////////
+#ifdef SFML_ENABLE_TRACING
+#define SFML_TRACE_ZONE(name) const sf::priv::TraceZone SFML_TRACE_CONCAT(sfmlTraceZone, __LINE__)(name)
+#define SFML_TRACE_CONCAT(a, b) SFML_TRACE_CONCAT_IMPL(a, b)
+#define SFML_TRACE_CONCAT_IMPL(a, b) a##b
+#else
+#define SFML_TRACE_ZONE(name) static_cast<void>(0)
+#endif
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Store a zone in the trace buffer of the calling thread
+///
+/// The event is dropped if the buffer is full.
+///
+/// \param name  Name of the zone
+/// \param start Start time on the steady clock, in nanoseconds
+/// \param end   End time on the steady clock, in nanoseconds
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void recordTraceZone(const char* name, std::int64_t start, std::int64_t end) noexcept;
+
+////////////////////////////////////////////////////////////
+/// \brief Scoped timer recording a trace zone on destruction
+///
+////////////////////////////////////////////////////////////
+class TraceZone
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the zone
+    ///
+    /// \param name Name of the zone
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TraceZone(const char* name) noexcept : m_name(name), m_start(now())
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the zone and record it
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TraceZone()
+    {
+        recordTraceZone(m_name, m_start, now());
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TraceZone(const TraceZone&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the steady clock
+    ///
+    /// \return Current time, in nanoseconds
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::int64_t now() noexcept
+    {
+        using namespace std::chrono;
+        return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const char*  m_name;  //!< Name of the zone
+    std::int64_t m_start; //!< Start time, in nanoseconds
+};
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Trace.hpp>
+#include <SFML/System/Tracing.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TracingImpl
+{
+// Number of events a thread can record between two flushes
+constexpr std::size_t bufferCapacity = 16384;
+
+// Zone recorded by a thread
+struct Record
+{
+    const char*  name;
+    std::int64_t start;
+    std::int64_t end;
+};
+
+// Single-producer single-consumer ring: the owning thread writes, flushes read
+struct ThreadBuffer
+{
+    std::uint64_t                      thread{};
+    std::array<Record, bufferCapacity> records{};
+    std::atomic<std::size_t>           head{0};
+    std::atomic<std::size_t>           tail{0};
+    std::atomic<bool>                  finished{false};
+};
+
+// Buffers of all the threads which ever recorded an event, until they are finished and flushed
+std::mutex                                 registryMutex;
+std::vector<std::shared_ptr<ThreadBuffer>> registry;
+std::uint64_t                              threadCount = 0;
+
+// Registers the buffer of the calling thread, and marks it finished when the thread exits
+struct ThreadBufferOwner
+{
+    ThreadBufferOwner() : buffer(std::make_shared<ThreadBuffer>())
+    {
+        std::scoped_lock lock(registryMutex);
+        buffer->thread = ++threadCount;
+        registry.push_back(buffer);
+    }
+
+    ~ThreadBufferOwner()
+    {
+        buffer->finished = true;
+    }
+
+    ThreadBufferOwner(const ThreadBufferOwner&)            = delete;
+    ThreadBufferOwner& operator=(const ThreadBufferOwner&) = delete;
+
+    std::shared_ptr<ThreadBuffer> buffer;
+};
+
+ThreadBuffer& getThreadBuffer()
+{
+    thread_local ThreadBufferOwner owner;
+    return *owner.buffer;
+}
+} // namespace TracingImpl
+} // namespace
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+void recordTraceZone(const char* name, std::int64_t start, std::int64_t end) noexcept
+{
+    TracingImpl::ThreadBuffer& buffer = TracingImpl::getThreadBuffer();
+
+    const std::size_t head = buffer.head.load(std::memory_order_relaxed);
+    const std::size_t tail = buffer.tail.load(std::memory_order_acquire);
+
+    // Drop the event rather than waiting for a flush
+    if (head - tail == TracingImpl::bufferCapacity)
+        return;
+
+    buffer.records[head % TracingImpl::bufferCapacity] = {name, start, end};
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+} // namespace priv
+
+
+namespace Tracing
+{
+////////////////////////////////////////////////////////////
+bool isEnabled()
+{
+#ifdef SFML_ENABLE_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void flush(const std::function<void(const Event&)>& callback)
+{
+    using namespace TracingImpl;
+
+    // Flushes are serialized, recording threads never wait for them
+    std::scoped_lock lock(registryMutex);
+
+    for (auto it = registry.begin(); it != registry.end();)
+    {
+        ThreadBuffer& buffer = **it;
+
+        // Read the finished flag first, so that no event recorded before the thread exited is missed
+        const bool        finished = buffer.finished;
+        const std::size_t tail     = buffer.tail.load(std::memory_order_relaxed);
+        const std::size_t head     = buffer.head.load(std::memory_order_acquire);
+
+        for (std::size_t i = tail; i != head; ++i)
+        {
+            const Record& record = buffer.records[i % bufferCapacity];
+
+            callback({record.name,
+                      buffer.thread,
+                      std::chrono::nanoseconds(record.start),
+                      std::chrono::nanoseconds(record.end - record.start)});
+        }
+
+        buffer.tail.store(head, std::memory_order_release);
+
+        it = finished ? registry.erase(it) : it + 1;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool flushToFile(const std::filesystem::path& filename)
+{
+    std::ofstream file(filename, std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to save trace\n" << formatDebugPathInfo(filename) << std::endl;
+
+        // Still drain the buffers, so that they don't fill up
+        flush([](const Event&) {});
+        return false;
+    }
+
+    // Timestamps and durations are in microseconds, with a nanosecond resolution
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    const char* separator = "\n";
+    flush(
+        [&](const Event& event)
+        {
+            file << separator << "{\"name\":\"" << event.name << R"(","ph":"X","pid":1,"tid":)" << event.thread
+                 << ",\"ts\":" << static_cast<double>(event.start.count()) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(event.duration.count()) / 1000.0 << '}';
+            separator = ",\n";
+        });
+
+    file << "\n]}\n";
+
+    if (!file)
+    {
+        err() << "Failed to save trace (write error)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Tracing
+
+} // namespace sf
@@ -76,8 +76,10 @@ using ContextType = sf::priv::EglContext;
 
 #else
 
+#include <SFML/Window/HeadlessEglContext.hpp>
 #include <SFML/Window/Unix/GlxContext.hpp>
 using ContextType = sf::priv::GlxContext;
+#define SFML_HEADLESS_CONTEXT_AVAILABLE
 
 #endif
 
@@ -179,7 +181,7 @@ unsigned int resourceCount = 0;
 thread_local sf::priv::GlContext* currentContext(nullptr);
 
 // The hidden, inactive context that will be shared with all other contexts
-std::unique_ptr<ContextType> sharedContext;
+std::unique_ptr<sf::priv::GlContext> sharedContext;
 
 // Unique identifier, used for identifying contexts when managing unshareable OpenGL resources
 std::uint64_t id = 1; // start at 1, zero is "no context"
@@ -191,6 +193,20 @@ std::uint64_t id = 1; // start at 1, zero is "no context"
 using ContextDestroyCallbacks = std::unordered_map<sf::ContextDestroyCallback, void*>;
 ContextDestroyCallbacks contextDestroyCallbacks;
 
+// Create a context of the type selected for this process, sharing with the given context
+template <typename... Args>
+std::unique_ptr<sf::priv::GlContext> createContext(sf::priv::GlContext* shared, const Args&... args)
+{
+#if defined(SFML_HEADLESS_CONTEXT_AVAILABLE)
+    // All contexts of a process have the same type, the shared one included
+    using sf::priv::HeadlessEglContext;
+    if (HeadlessEglContext::isSelected())
+        return std::make_unique<HeadlessEglContext>(static_cast<HeadlessEglContext*>(shared), args...);
+#endif
+
+    return std::make_unique<ContextType>(static_cast<ContextType*>(shared), args...);
+}
+
 // This structure contains all the state necessary to
 // track TransientContext usage
 struct TransientContext
@@ -332,6 +348,7 @@ namespace priv
 ////////////////////////////////////////////////////////////
 void GlContext::initResource()
 {
+    using GlContextImpl::createContext;
     using GlContextImpl::currentContext;
     using GlContextImpl::loadExtensions;
     using GlContextImpl::mutex;
@@ -353,7 +370,7 @@ void GlContext::initResource()
         }
 
         // Create the shared context
-        sharedContext = std::make_unique<ContextType>(nullptr);
+        sharedContext = createContext(nullptr);
         sharedContext->initialize(ContextSettings());
 
         // Load our extensions vector
@@ -447,6 +464,7 @@ void GlContext::releaseTransientContext()
 ////////////////////////////////////////////////////////////
 std::unique_ptr<GlContext> GlContext::create()
 {
+    using GlContextImpl::createContext;
     using GlContextImpl::mutex;
     using GlContextImpl::sharedContext;
 
@@ -464,7 +482,7 @@ std::unique_ptr<GlContext> GlContext::create()
         sharedContext->setActive(true);
 
         // Create the context
-        context = std::make_unique<ContextType>(sharedContext.get());
+        context = createContext(sharedContext.get());
 
         sharedContext->setActive(false);
     }
@@ -478,6 +496,7 @@ std::unique_ptr<GlContext> GlContext::create()
 ////////////////////////////////////////////////////////////
 std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, const WindowImpl& owner, unsigned int bitsPerPixel)
 {
+    using GlContextImpl::createContext;
     using GlContextImpl::loadExtensions;
     using GlContextImpl::mutex;
     using GlContextImpl::resourceCount;
@@ -498,7 +517,7 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
         // Re-create our shared context as a core context
         ContextSettings sharedSettings(0, 0, 0, settings.majorVersion, settings.minorVersion, settings.attributeFlags);
 
-        sharedContext = std::make_unique<ContextType>(nullptr, sharedSettings, Vector2u(1, 1));
+        sharedContext = createContext(nullptr, sharedSettings, Vector2u(1, 1));
         sharedContext->initialize(sharedSettings);
 
         // Reload our extensions vector
@@ -514,7 +533,7 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
         sharedContext->setActive(true);
 
         // Create the context
-        context = std::make_unique<ContextType>(sharedContext.get(), settings, owner, bitsPerPixel);
+        context = createContext(sharedContext.get(), settings, owner, bitsPerPixel);
 
         sharedContext->setActive(false);
     }
@@ -529,6 +548,7 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
 ////////////////////////////////////////////////////////////
 std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, const Vector2u& size)
 {
+    using GlContextImpl::createContext;
     using GlContextImpl::loadExtensions;
     using GlContextImpl::mutex;
     using GlContextImpl::resourceCount;
@@ -549,7 +569,7 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
         // Re-create our shared context as a core context
         ContextSettings sharedSettings(0, 0, 0, settings.majorVersion, settings.minorVersion, settings.attributeFlags);
 
-        sharedContext = std::make_unique<ContextType>(nullptr, sharedSettings, Vector2u(1, 1));
+        sharedContext = createContext(nullptr, sharedSettings, Vector2u(1, 1));
         sharedContext->initialize(sharedSettings);
 
         // Reload our extensions vector
@@ -565,7 +585,7 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
         sharedContext->setActive(true);
 
         // Create the context
-        context = std::make_unique<ContextType>(sharedContext.get(), settings, size);
+        context = createContext(sharedContext.get(), settings, size);
 
         sharedContext->setActive(false);
     }
@@ -590,6 +610,11 @@ GlFunctionPointer GlContext::getFunction(const char* name)
 {
     std::scoped_lock lock(GlContextImpl::mutex);
 
+#if defined(SFML_HEADLESS_CONTEXT_AVAILABLE)
+    if (HeadlessEglContext::isSelected())
+        return HeadlessEglContext::getFunction(name);
+#endif
+
     return ContextType::getFunction(name);
 }
 
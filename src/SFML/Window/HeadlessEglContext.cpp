@@ -0,0 +1,476 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Err.hpp>
+#include <SFML/Window/EGLCheck.hpp>
+#include <SFML/Window/HeadlessEglContext.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+// We check for this definition in order to avoid multiple definitions of GLAD
+// entities during unity builds of SFML.
+#ifndef SF_GLAD_EGL_IMPLEMENTATION_INCLUDED
+#define SF_GLAD_EGL_IMPLEMENTATION_INCLUDED
+#define SF_GLAD_EGL_IMPLEMENTATION
+#include <glad/egl.h>
+#endif
+
+// Platform extensions not covered by the EGL loader
+#if !defined(EGL_PLATFORM_DEVICE_EXT)
+#define EGL_PLATFORM_DEVICE_EXT 0x313F
+#endif
+
+#if !defined(EGL_PLATFORM_SURFACELESS_MESA)
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace HeadlessEglContextImpl
+{
+using GetPlatformDisplayFunc = EGLDisplay(GLAD_API_PTR*)(EGLenum, void*, const EGLint*);
+using QueryDevicesFunc       = EGLBoolean(GLAD_API_PTR*)(EGLint, void**, EGLint*);
+
+
+////////////////////////////////////////////////////////////
+bool hasExtension(const char* extensions, const char* name)
+{
+    if (!extensions)
+        return false;
+
+    const std::size_t length = std::strlen(name);
+
+    for (const char* start = std::strstr(extensions, name); start; start = std::strstr(start + length, name))
+    {
+        // Make sure we matched a whole word and not the prefix of a longer extension name
+        if (((start == extensions) || (start[-1] == ' ')) && ((start[length] == ' ') || (start[length] == '\0')))
+            return true;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+EGLDisplay openPlatformDisplay()
+{
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    auto getPlatformDisplay = reinterpret_cast<GetPlatformDisplayFunc>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+    if (getPlatformDisplay && hasExtension(clientExtensions, "EGL_EXT_platform_base"))
+    {
+        // Prefer talking to the first GPU directly, this works with every driver exposing EGL devices
+        auto queryDevices = reinterpret_cast<QueryDevicesFunc>(eglGetProcAddress("eglQueryDevicesEXT"));
+
+        if (queryDevices && hasExtension(clientExtensions, "EGL_EXT_platform_device"))
+        {
+            void*  device      = nullptr;
+            EGLint deviceCount = 0;
+
+            if ((queryDevices(1, &device, &deviceCount) == EGL_TRUE) && (deviceCount > 0))
+            {
+                EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+
+                if ((display != EGL_NO_DISPLAY) && (eglInitialize(display, nullptr, nullptr) == EGL_TRUE))
+                    return display;
+            }
+        }
+
+        // Mesa also provides a platform that needs neither a window system nor a device
+        if (hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+
+            if ((display != EGL_NO_DISPLAY) && (eglInitialize(display, nullptr, nullptr) == EGL_TRUE))
+                return display;
+        }
+    }
+
+    // Last resort: let the implementation pick its default platform
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if ((display != EGL_NO_DISPLAY) && (eglInitialize(display, nullptr, nullptr) == EGL_TRUE))
+        return display;
+
+    return EGL_NO_DISPLAY;
+}
+
+
+////////////////////////////////////////////////////////////
+EGLDisplay getInitializedDisplay()
+{
+    static std::once_flag initialized;
+    static EGLDisplay     display = EGL_NO_DISPLAY;
+
+    std::call_once(initialized,
+                   []
+                   {
+                       // We don't check the return value since the extension
+                       // flags are cleared even if loading fails
+                       gladLoaderLoadEGL(EGL_NO_DISPLAY);
+
+                       display = openPlatformDisplay();
+
+                       if (display == EGL_NO_DISPLAY)
+                       {
+                           sf::err() << "Failed to open an EGL display for headless rendering" << std::endl;
+                           return;
+                       }
+
+                       // Continue loading with a display
+                       gladLoaderLoadEGL(display);
+                   });
+
+    return display;
+}
+
+
+////////////////////////////////////////////////////////////
+bool bindOpenGLApi()
+{
+    // The bound API is per-thread state, it has to be set on every thread using our contexts
+    EGLBoolean result = EGL_FALSE;
+    eglCheck(result = eglBindAPI(EGL_OPENGL_API));
+
+    return result == EGL_TRUE;
+}
+} // namespace HeadlessEglContextImpl
+} // namespace
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+HeadlessEglContext::HeadlessEglContext(HeadlessEglContext* shared)
+{
+    // Get the initialized EGL display
+    m_display = HeadlessEglContextImpl::getInitializedDisplay();
+
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    // Create the context and a minimal surface, if the display needs one
+    createContext(shared, ContextSettings());
+    createSurface(Vector2u(1, 1), false);
+}
+
+
+////////////////////////////////////////////////////////////
+HeadlessEglContext::HeadlessEglContext(HeadlessEglContext*    shared,
+                                       const ContextSettings& settings,
+                                       const WindowImpl& /*owner*/,
+                                       unsigned int /*bitsPerPixel*/)
+{
+    err() << "Warning: windows can't be displayed in headless mode, rendering to an offscreen surface instead"
+          << std::endl;
+
+    // Get the initialized EGL display
+    m_display = HeadlessEglContextImpl::getInitializedDisplay();
+
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    // Create the context and a minimal surface, if the display needs one
+    createContext(shared, settings);
+    createSurface(Vector2u(1, 1), false);
+}
+
+
+////////////////////////////////////////////////////////////
+HeadlessEglContext::HeadlessEglContext(HeadlessEglContext*    shared,
+                                       const ContextSettings& settings,
+                                       const Vector2u&        size)
+{
+    // Get the initialized EGL display
+    m_display = HeadlessEglContextImpl::getInitializedDisplay();
+
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    // Create the context and a back buffer of the requested size
+    createContext(shared, settings);
+    createSurface(size, true);
+}
+
+
+////////////////////////////////////////////////////////////
+HeadlessEglContext::~HeadlessEglContext()
+{
+    // Notify unshared OpenGL resources of context destruction
+    cleanupUnsharedResources();
+
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    // Deactivate the current context
+    EGLContext currentContext = EGL_NO_CONTEXT;
+    eglCheck(currentContext = eglGetCurrentContext());
+
+    if (currentContext == m_context)
+    {
+        eglCheck(eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    }
+
+    // Destroy context
+    if (m_context != EGL_NO_CONTEXT)
+    {
+        eglCheck(eglDestroyContext(m_display, m_context));
+    }
+
+    // Destroy surface
+    if (m_surface != EGL_NO_SURFACE)
+    {
+        eglCheck(eglDestroySurface(m_display, m_surface));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool HeadlessEglContext::isSelected()
+{
+    static const bool selected = []
+    {
+        if (const char* headless = std::getenv("SFML_HEADLESS"); headless && (*headless != '\0'))
+            return std::strcmp(headless, "0") != 0;
+
+        // Without a display server there's no other way to get a context anyway
+        const char* display = std::getenv("DISPLAY");
+        return !display || (*display == '\0');
+    }();
+
+    return selected;
+}
+
+
+////////////////////////////////////////////////////////////
+GlFunctionPointer HeadlessEglContext::getFunction(const char* name)
+{
+    HeadlessEglContextImpl::getInitializedDisplay();
+
+    return eglGetProcAddress(name);
+}
+
+
+////////////////////////////////////////////////////////////
+bool HeadlessEglContext::makeCurrent(bool current)
+{
+    if ((m_context == EGL_NO_CONTEXT) || ((m_surface == EGL_NO_SURFACE) && !m_surfaceless))
+        return false;
+
+    EGLBoolean result = EGL_FALSE;
+
+    if (current)
+    {
+        if (!HeadlessEglContextImpl::bindOpenGLApi())
+            return false;
+
+        eglCheck(result = eglMakeCurrent(m_display, m_surface, m_surface, m_context));
+    }
+    else
+    {
+        eglCheck(result = eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    }
+
+    return result != EGL_FALSE;
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessEglContext::display()
+{
+    // Single buffered offscreen surfaces have nothing to swap, just make sure the rendering is done
+    if (m_context != EGL_NO_CONTEXT)
+        eglCheck(eglWaitClient());
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessEglContext::setVerticalSyncEnabled(bool /*enabled*/)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessEglContext::createContext(HeadlessEglContext* shared, const ContextSettings& settings)
+{
+    if (!HeadlessEglContextImpl::bindOpenGLApi())
+    {
+        err() << "Failed to bind the desktop OpenGL API to EGL" << std::endl;
+        return;
+    }
+
+    // Choose the best config for an offscreen 32-bit color buffer
+    const EGLint configAttributes[] = {EGL_SURFACE_TYPE,
+                                       EGL_PBUFFER_BIT,
+                                       EGL_RENDERABLE_TYPE,
+                                       EGL_OPENGL_BIT,
+                                       EGL_RED_SIZE,
+                                       8,
+                                       EGL_GREEN_SIZE,
+                                       8,
+                                       EGL_BLUE_SIZE,
+                                       8,
+                                       EGL_ALPHA_SIZE,
+                                       8,
+                                       EGL_DEPTH_SIZE,
+                                       static_cast<EGLint>(settings.depthBits),
+                                       EGL_STENCIL_SIZE,
+                                       static_cast<EGLint>(settings.stencilBits),
+                                       EGL_SAMPLE_BUFFERS,
+                                       settings.antialiasingLevel ? 1 : 0,
+                                       EGL_SAMPLES,
+                                       static_cast<EGLint>(settings.antialiasingLevel),
+                                       EGL_NONE};
+
+    EGLint configCount = 0;
+    eglCheck(eglChooseConfig(m_display, configAttributes, &m_config, 1, &configCount));
+
+    if (configCount == 0)
+    {
+        err() << "No EGL config supports headless desktop OpenGL rendering with the requested settings" << std::endl;
+        return;
+    }
+
+    updateSettings();
+
+    // Only ask for a specific version when the user did, so that the driver can pick its best default otherwise
+    std::vector<EGLint> contextAttributes;
+
+    if ((settings.majorVersion > 1) || ((settings.majorVersion == 1) && (settings.minorVersion > 1)))
+    {
+        contextAttributes.insert(contextAttributes.end(),
+                                 {EGL_CONTEXT_MAJOR_VERSION,
+                                  static_cast<EGLint>(settings.majorVersion),
+                                  EGL_CONTEXT_MINOR_VERSION,
+                                  static_cast<EGLint>(settings.minorVersion)});
+
+        // Profiles only exist since OpenGL 3.2
+        if ((settings.majorVersion > 3) || ((settings.majorVersion == 3) && (settings.minorVersion >= 2)))
+        {
+            contextAttributes.insert(contextAttributes.end(),
+                                     {EGL_CONTEXT_OPENGL_PROFILE_MASK,
+                                      (settings.attributeFlags & ContextSettings::Core)
+                                          ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT
+                                          : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT});
+        }
+    }
+
+    if (settings.attributeFlags & ContextSettings::Debug)
+        contextAttributes.insert(contextAttributes.end(), {EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE});
+
+    contextAttributes.push_back(EGL_NONE);
+
+    const EGLContext toShare = shared ? shared->m_context : EGL_NO_CONTEXT;
+
+    if (toShare != EGL_NO_CONTEXT)
+        eglCheck(eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+    // Create EGL context
+    eglCheck(m_context = eglCreateContext(m_display, m_config, toShare, contextAttributes.data()));
+
+    if ((m_context == EGL_NO_CONTEXT) && (contextAttributes.size() > 1))
+    {
+        // The requested version or flags aren't supported, fall back to the default context;
+        // the mismatch is reported once the context is initialized
+        const EGLint defaultAttributes[] = {EGL_NONE};
+        eglCheck(m_context = eglCreateContext(m_display, m_config, toShare, defaultAttributes));
+    }
+
+    if (m_context == EGL_NO_CONTEXT)
+        err() << "Failed to create a headless EGL context" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessEglContext::createSurface(const Vector2u& size, bool required)
+{
+    if (m_context == EGL_NO_CONTEXT)
+        return;
+
+    const bool surfacelessAvailable = HeadlessEglContextImpl::hasExtension(eglQueryString(m_display, EGL_EXTENSIONS),
+                                                                           "EGL_KHR_surfaceless_context");
+
+    // Rendering goes to framebuffer objects anyway, so skip the pbuffer whenever the driver allows it
+    if (!required && surfacelessAvailable)
+    {
+        m_surfaceless = true;
+        return;
+    }
+
+    const EGLint attributes[] = {EGL_WIDTH,
+                                 static_cast<EGLint>(size.x),
+                                 EGL_HEIGHT,
+                                 static_cast<EGLint>(size.y),
+                                 EGL_NONE};
+
+    eglCheck(m_surface = eglCreatePbufferSurface(m_display, m_config, attributes));
+
+    if (m_surface == EGL_NO_SURFACE)
+    {
+        if (surfacelessAvailable)
+        {
+            m_surfaceless = true;
+        }
+        else
+        {
+            err() << "Failed to create a " << size.x << "x" << size.y << " pbuffer for headless rendering" << std::endl;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessEglContext::updateSettings()
+{
+    EGLint tmp = 0;
+
+    // Update the internal context settings with the current config
+    if (eglGetConfigAttrib(m_display, m_config, EGL_DEPTH_SIZE, &tmp) == EGL_TRUE)
+        m_settings.depthBits = static_cast<unsigned int>(tmp);
+
+    if (eglGetConfigAttrib(m_display, m_config, EGL_STENCIL_SIZE, &tmp) == EGL_TRUE)
+        m_settings.stencilBits = static_cast<unsigned int>(tmp);
+
+    if (eglGetConfigAttrib(m_display, m_config, EGL_SAMPLES, &tmp) == EGL_TRUE)
+        m_settings.antialiasingLevel = static_cast<unsigned int>(tmp);
+
+    m_settings.sRgbCapable = false;
+}
+
+} // namespace priv
+
+} // namespace sf
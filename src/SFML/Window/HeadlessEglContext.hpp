@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2022 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Window/ContextSettings.hpp>
+#include <SFML/Window/GlContext.hpp>
+
+#include <glad/egl.h>
+
+
+namespace sf
+{
+namespace priv
+{
+class WindowImpl;
+
+////////////////////////////////////////////////////////////
+/// \brief Offscreen EGL implementation of desktop OpenGL contexts
+///
+/// This context type doesn't need any window system: it
+/// renders through a surfaceless context or a pbuffer on an
+/// EGL display obtained from the GPU device directly. It is
+/// selected instead of the regular context type when no
+/// display server is available, which makes sf::Context and
+/// sf::RenderTexture usable on servers and CI machines.
+///
+////////////////////////////////////////////////////////////
+class HeadlessEglContext : public GlContext
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new default context
+    ///
+    /// \param shared Context to share the new one with (can be a null pointer)
+    ///
+    ////////////////////////////////////////////////////////////
+    HeadlessEglContext(HeadlessEglContext* shared);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new context attached to a window
+    ///
+    /// Windows can't be displayed without a window system, this
+    /// creates an offscreen context of the requested settings
+    /// instead and prints a warning.
+    ///
+    /// \param shared       Context to share the new one with
+    /// \param settings     Creation parameters
+    /// \param owner        Pointer to the owner window
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    ///
+    ////////////////////////////////////////////////////////////
+    HeadlessEglContext(HeadlessEglContext*    shared,
+                       const ContextSettings& settings,
+                       const WindowImpl&      owner,
+                       unsigned int           bitsPerPixel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new context that embeds its own rendering target
+    ///
+    /// \param shared   Context to share the new one with
+    /// \param settings Creation parameters
+    /// \param size     Back buffer width and height, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    HeadlessEglContext(HeadlessEglContext* shared, const ContextSettings& settings, const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~HeadlessEglContext() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether headless contexts should be used
+    ///
+    /// Headless contexts are used when the SFML_HEADLESS
+    /// environment variable is set to a value other than 0,
+    /// or when the DISPLAY environment variable is empty.
+    /// The decision is taken once and cached for the lifetime
+    /// of the process.
+    ///
+    /// \return True if headless contexts should be created
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isSelected();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of an OpenGL function
+    ///
+    /// \param name Name of the function to get the address of
+    ///
+    /// \return Address of the OpenGL function, 0 on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    static GlFunctionPointer getFunction(const char* name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the context as the current target for rendering
+    ///
+    /// \param current Whether to make the context current or no longer current
+    ///
+    /// \return True on success, false if any error happened
+    ///
+    ////////////////////////////////////////////////////////////
+    bool makeCurrent(bool current) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Display what has been rendered to the context so far
+    ///
+    ////////////////////////////////////////////////////////////
+    void display() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable vertical synchronization
+    ///
+    /// Offscreen surfaces are never synchronized with a monitor,
+    /// so this function does nothing.
+    ///
+    /// \param enabled True to enable v-sync, false to deactivate
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVerticalSyncEnabled(bool enabled) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the context
+    ///
+    /// \param shared   Context to share the new one with (can be a null pointer)
+    /// \param settings Creation parameters
+    ///
+    ////////////////////////////////////////////////////////////
+    void createContext(HeadlessEglContext* shared, const ContextSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the offscreen surface
+    ///
+    /// When the display supports surfaceless contexts and no
+    /// particular size is needed, no surface is created at all.
+    ///
+    /// \param size     Back buffer width and height, in pixels
+    /// \param required Whether a back buffer of this size is needed
+    ///
+    ////////////////////////////////////////////////////////////
+    void createSurface(const Vector2u& size, bool required);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the context settings from the selected config
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateSettings();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    EGLDisplay m_display{EGL_NO_DISPLAY}; //!< The internal EGL display
+    EGLContext m_context{EGL_NO_CONTEXT}; //!< The internal EGL context
+    EGLSurface m_surface{EGL_NO_SURFACE}; //!< The internal EGL surface, if any
+    EGLConfig  m_config{nullptr};         //!< The internal EGL config
+    bool       m_surfaceless{};           //!< Whether the context is made current without a surface
+};
+
+} // namespace priv
+
+} // namespace sf
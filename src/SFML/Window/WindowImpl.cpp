@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Sleep.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Trace.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/JoystickImpl.hpp>
 #include <SFML/Window/JoystickManager.hpp>
@@ -145,6 +146,8 @@ void WindowImpl::setJoystickThreshold(float threshold)
 ////////////////////////////////////////////////////////////
 bool WindowImpl::popEvent(Event& event, bool block)
 {
+    SFML_TRACE_ZONE("WindowImpl::popEvent");
+
     // If the event queue is empty, let's first check if new events are available from the OS
     if (m_events.empty())
     {
@@ -0,0 +1,8 @@
+#include <SFML/Audio/QueuedSoundRecorder.hpp>
+
+#include <type_traits>
+
+static_assert(!std::is_copy_constructible_v<sf::QueuedSoundRecorder>);
+static_assert(!std::is_copy_assignable_v<sf::QueuedSoundRecorder>);
+static_assert(!std::is_nothrow_move_constructible_v<sf::QueuedSoundRecorder>);
+static_assert(!std::is_nothrow_move_assignable_v<sf::QueuedSoundRecorder>);
@@ -0,0 +1,8 @@
+#include <SFML/Audio/SoundBufferCache.hpp>
+
+#include <type_traits>
+
+static_assert(!std::is_copy_constructible_v<sf::SoundBufferCache>);
+static_assert(!std::is_copy_assignable_v<sf::SoundBufferCache>);
+static_assert(std::is_nothrow_move_constructible_v<sf::SoundBufferCache>);
+static_assert(std::is_nothrow_move_assignable_v<sf::SoundBufferCache>);
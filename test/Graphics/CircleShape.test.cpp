@@ -4,6 +4,7 @@
 
 #include <SystemUtil.hpp>
 #include <type_traits>
+#include <vector>
 
 static_assert(std::is_copy_constructible_v<sf::CircleShape>);
 static_assert(std::is_copy_assignable_v<sf::CircleShape>);
@@ -108,4 +109,13 @@ TEST_CASE("[Graphics] sf::CircleShape")
         CHECK(triangle.getPoint(1) == Approx(sf::Vector2f(3.732050896f, 3.000000000f)));
         CHECK(triangle.getPoint(2) == Approx(sf::Vector2f(0.267949224f, 3.000000000f)));
     }
+
+    SUBCASE("Get points")
+    {
+        const sf::CircleShape     circle(5.f, 8);
+        std::vector<sf::Vector2f> points(circle.getPointCount());
+        circle.getPoints(points.data());
+        for (std::size_t i = 0; i < circle.getPointCount(); ++i)
+            CHECK(points[i] == circle.getPoint(i));
+    }
 }
@@ -0,0 +1,104 @@
+#include <SFML/Graphics/CullingGrid.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <doctest/doctest.h>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_copy_constructible_v<sf::CullingGrid>);
+static_assert(std::is_copy_assignable_v<sf::CullingGrid>);
+static_assert(std::is_nothrow_move_constructible_v<sf::CullingGrid>);
+static_assert(std::is_nothrow_move_assignable_v<sf::CullingGrid>);
+
+namespace
+{
+class DummyDrawable : public sf::Drawable
+{
+    void draw(sf::RenderTarget&, const sf::RenderStates&) const override
+    {
+    }
+};
+} // namespace
+
+TEST_CASE("[Graphics] sf::CullingGrid")
+{
+    const DummyDrawable              a, b, c;
+    std::vector<const sf::Drawable*> found;
+
+    SUBCASE("Construction")
+    {
+        const sf::CullingGrid grid;
+        CHECK(grid.getDrawableCount() == 0);
+
+        grid.query(sf::FloatRect({0, 0}, {100, 100}), found);
+        CHECK(found.empty());
+    }
+
+    SUBCASE("Query")
+    {
+        sf::CullingGrid grid(10.f);
+        CHECK(grid.insert(a, sf::FloatRect({0, 0}, {5, 5})) == 0);
+        CHECK(grid.insert(b, sf::FloatRect({-25, -25}, {50, 50})) == 1);
+        CHECK(grid.insert(c, sf::FloatRect({100, 100}, {5, 5})) == 2);
+        CHECK(grid.getDrawableCount() == 3);
+
+        grid.query(sf::FloatRect({1, 1}, {2, 2}), found);
+        CHECK(found == std::vector<const sf::Drawable*>{&a, &b});
+
+        grid.query(sf::FloatRect({6, 6}, {2, 2}), found);
+        CHECK(found == std::vector<const sf::Drawable*>{&b});
+
+        grid.query(sf::FloatRect({-1000, -1000}, {2000, 2000}), found);
+        CHECK(found == std::vector<const sf::Drawable*>{&a, &b, &c});
+
+        grid.query(sf::FloatRect({500, 500}, {10, 10}), found);
+        CHECK(found.empty());
+    }
+
+    SUBCASE("Update and remove")
+    {
+        sf::CullingGrid grid(10.f);
+        const std::size_t handleA = grid.insert(a, sf::FloatRect({0, 0}, {5, 5}));
+        const std::size_t handleB = grid.insert(b, sf::FloatRect({50, 50}, {5, 5}));
+
+        grid.update(handleA, sf::FloatRect({51, 51}, {5, 5}));
+        grid.query(sf::FloatRect({0, 0}, {10, 10}), found);
+        CHECK(found.empty());
+        grid.query(sf::FloatRect({52, 52}, {1, 1}), found);
+        CHECK(found == std::vector<const sf::Drawable*>{&a, &b});
+
+        grid.remove(handleB);
+        CHECK(grid.getDrawableCount() == 1);
+        grid.query(sf::FloatRect({52, 52}, {1, 1}), found);
+        CHECK(found == std::vector<const sf::Drawable*>{&a});
+
+        CHECK(grid.insert(c, sf::FloatRect({0, 0}, {5, 5})) == handleB);
+
+        grid.clear();
+        CHECK(grid.getDrawableCount() == 0);
+        grid.query(sf::FloatRect({-1000, -1000}, {2000, 2000}), found);
+        CHECK(found.empty());
+    }
+
+    SUBCASE("View")
+    {
+        sf::View view({100, 100}, {200, 100});
+
+        sf::FloatRect area = sf::CullingGrid::computeVisibleArea(view);
+        CHECK(area.getPosition() == Approx(sf::Vector2f(0, 50)));
+        CHECK(area.getSize() == Approx(sf::Vector2f(200, 100)));
+
+        view.setRotation(sf::degrees(90));
+        area = sf::CullingGrid::computeVisibleArea(view);
+        CHECK(area.getPosition() == Approx(sf::Vector2f(50, 0)));
+        CHECK(area.getSize() == Approx(sf::Vector2f(100, 200)));
+
+        sf::CullingGrid grid(64.f);
+        grid.insert(a, sf::FloatRect({60, 10}, {5, 5}));
+        grid.insert(b, sf::FloatRect({10, 10}, {5, 5}));
+        grid.query(view, found);
+        CHECK(found == std::vector<const sf::Drawable*>{&a});
+    }
+}
@@ -0,0 +1,10 @@
+#include <SFML/Graphics/IndexBuffer.hpp>
+
+#include <type_traits>
+
+static_assert(std::is_copy_constructible_v<sf::IndexBuffer>);
+static_assert(std::is_copy_assignable_v<sf::IndexBuffer>);
+static_assert(std::is_move_constructible_v<sf::IndexBuffer>);
+static_assert(!std::is_nothrow_move_constructible_v<sf::IndexBuffer>);
+static_assert(std::is_move_assignable_v<sf::IndexBuffer>);
+static_assert(!std::is_nothrow_move_assignable_v<sf::IndexBuffer>);
@@ -0,0 +1,165 @@
+#include <SFML/Graphics/ParticleSystem.hpp>
+
+#include <doctest/doctest.h>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+static_assert(std::is_copy_constructible_v<sf::ParticleSystem>);
+static_assert(std::is_copy_assignable_v<sf::ParticleSystem>);
+static_assert(std::is_move_constructible_v<sf::ParticleSystem>);
+static_assert(!std::is_nothrow_move_constructible_v<sf::ParticleSystem>);
+static_assert(std::is_move_assignable_v<sf::ParticleSystem>);
+static_assert(!std::is_nothrow_move_assignable_v<sf::ParticleSystem>);
+
+TEST_CASE("[Graphics] sf::ParticleSystem")
+{
+    SUBCASE("Construction")
+    {
+        const sf::ParticleSystem particles(10);
+        CHECK(particles.getCapacity() == 10);
+        CHECK(particles.getParticleCount() == 0);
+        CHECK(particles.getAcceleration() == sf::Vector2f());
+        CHECK(particles.getFadeColor() == sf::Color(255, 255, 255, 0));
+        CHECK(particles.getTexture() == nullptr);
+        CHECK(particles.getTextureRect() == sf::IntRect());
+    }
+
+    SUBCASE("Emit")
+    {
+        sf::ParticleSystem particles(3);
+        particles.setTextureRect({{1, 2}, {3, 4}});
+
+        SUBCASE("Up to the capacity")
+        {
+            CHECK(particles.emit({0, 0}, {0, 0}, sf::seconds(1)));
+            CHECK(particles.emit({0, 0}, {0, 0}, sf::seconds(1)));
+            CHECK(particles.emit({0, 0}, {0, 0}, sf::seconds(1)));
+            CHECK(particles.getParticleCount() == 3);
+
+            CHECK_FALSE(particles.emit({0, 0}, {0, 0}, sf::seconds(1)));
+            CHECK(particles.getParticleCount() == 3);
+
+            particles.clear();
+            CHECK(particles.getParticleCount() == 0);
+            CHECK(particles.emit({0, 0}, {0, 0}, sf::seconds(1)));
+        }
+
+        SUBCASE("Vertices are written immediately")
+        {
+            particles.emit({10, 20}, {0, 0}, sf::seconds(1), sf::Color::Red, 4.f);
+
+            const sf::Vertex* vertices = particles.getVertices();
+            CHECK(vertices[0].position == sf::Vector2f(8, 18));
+            CHECK(vertices[1].position == sf::Vector2f(8, 22));
+            CHECK(vertices[2].position == sf::Vector2f(12, 18));
+            CHECK(vertices[3].position == sf::Vector2f(12, 22));
+            CHECK(vertices[0].texCoords == sf::Vector2f(1, 2));
+            CHECK(vertices[3].texCoords == sf::Vector2f(4, 6));
+            for (int i = 0; i < 4; ++i)
+                CHECK(vertices[i].color == sf::Color::Red);
+
+            // A particle emitted after an update is not drawn with stale vertices
+            particles.update(sf::milliseconds(100));
+            particles.emit({-5, 0}, {0, 0}, sf::seconds(1), sf::Color::Blue, 2.f);
+            CHECK(particles.getVertices()[4].position == sf::Vector2f(-6, -1));
+            CHECK(particles.getVertices()[7].position == sf::Vector2f(-4, 1));
+            CHECK(particles.getVertices()[4].color == sf::Color::Blue);
+        }
+    }
+
+    SUBCASE("Update")
+    {
+        sf::ParticleSystem particles(4);
+
+        SUBCASE("Integration")
+        {
+            particles.setAcceleration({0, 20});
+            particles.emit({0, 0}, {10, 0}, sf::seconds(1), sf::Color::White, 2.f);
+
+            // Velocities are updated before positions
+            particles.update(sf::milliseconds(500));
+            CHECK(particles.getParticleCount() == 1);
+            CHECK(particles.getVertices()[0].position == Approx(sf::Vector2f(4, 4)));
+            CHECK(particles.getVertices()[3].position == Approx(sf::Vector2f(6, 6)));
+
+            particles.update(sf::milliseconds(250));
+            CHECK(particles.getVertices()[0].position == Approx(sf::Vector2f(6.5f, 7.75f)));
+        }
+
+        SUBCASE("Fading")
+        {
+            particles.setFadeColor(sf::Color(0, 255, 255, 0));
+            particles.emit({0, 0}, {0, 0}, sf::seconds(2), sf::Color(200, 100, 50, 255));
+
+            particles.update(sf::milliseconds(500));
+            CHECK(particles.getVertices()[0].color == sf::Color(150, 100, 50, 191));
+            particles.update(sf::milliseconds(1000));
+            CHECK(particles.getVertices()[0].color == sf::Color(50, 100, 50, 63));
+        }
+
+        SUBCASE("Dead particles are removed and the survivors keep their order")
+        {
+            particles.emit({0, 0}, {0, 0}, sf::seconds(1));
+            particles.emit({1, 0}, {0, 0}, sf::seconds(3));
+            particles.emit({2, 0}, {0, 0}, sf::seconds(2));
+            particles.emit({3, 0}, {0, 0}, sf::seconds(4));
+
+            particles.update(sf::milliseconds(1500));
+            CHECK(particles.getParticleCount() == 3);
+            CHECK(particles.getVertices()[0].position == sf::Vector2f(0.5f, -0.5f));
+            CHECK(particles.getVertices()[4].position == sf::Vector2f(1.5f, -0.5f));
+            CHECK(particles.getVertices()[8].position == sf::Vector2f(2.5f, -0.5f));
+
+            particles.update(sf::milliseconds(1000));
+            CHECK(particles.getParticleCount() == 2);
+            CHECK(particles.getVertices()[0].position == sf::Vector2f(0.5f, -0.5f));
+            CHECK(particles.getVertices()[4].position == sf::Vector2f(2.5f, -0.5f));
+
+            // Room was made for new particles
+            CHECK(particles.emit({9, 0}, {0, 0}, sf::seconds(1)));
+            CHECK(particles.emit({9, 0}, {0, 0}, sf::seconds(1)));
+            CHECK_FALSE(particles.emit({9, 0}, {0, 0}, sf::seconds(1)));
+
+            particles.update(sf::seconds(10));
+            CHECK(particles.getParticleCount() == 0);
+        }
+    }
+
+    SUBCASE("Update in several blocks")
+    {
+        // Large enough to be split in 3 blocks
+        constexpr std::size_t count = 3 * 4096;
+        sf::ParticleSystem    particles(count);
+
+        // One particle out of 2 dies, and all the particles of the last quarter
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const bool dies = (i % 2 == 1) || (i >= count * 3 / 4);
+            particles.emit({static_cast<float>(i), 0}, {0, 1}, dies ? sf::seconds(1) : sf::seconds(3));
+        }
+
+        particles.update(sf::seconds(2), 3);
+        REQUIRE(particles.getParticleCount() == count * 3 / 8);
+
+        // The survivors are compacted at the beginning, in their emission order
+        bool compacted = true;
+        for (std::size_t i = 0; i < particles.getParticleCount(); ++i)
+        {
+            const sf::Vector2f expected(static_cast<float>(i * 2) - 0.5f, 1.5f);
+            compacted = compacted && (particles.getVertices()[i * 4].position == expected);
+        }
+        CHECK(compacted);
+
+        // The same particles with a single thread
+        sf::ParticleSystem reference(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const bool dies = (i % 2 == 1) || (i >= count * 3 / 4);
+            reference.emit({static_cast<float>(i), 0}, {0, 1}, dies ? sf::seconds(1) : sf::seconds(3));
+        }
+
+        reference.update(sf::seconds(2));
+        CHECK(reference.getParticleCount() == particles.getParticleCount());
+    }
+}
@@ -0,0 +1,84 @@
+#include <SFML/Graphics/PolygonShape.hpp>
+
+#include <doctest/doctest.h>
+
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+#include <type_traits>
+
+static_assert(std::is_copy_constructible_v<sf::PolygonShape>);
+static_assert(std::is_copy_assignable_v<sf::PolygonShape>);
+static_assert(std::is_move_constructible_v<sf::PolygonShape>);
+static_assert(std::is_move_assignable_v<sf::PolygonShape>);
+
+TEST_CASE("[Graphics] sf::PolygonShape")
+{
+    SUBCASE("Default constructor")
+    {
+        const sf::PolygonShape polygon;
+        CHECK(polygon.getPointCount() == 0);
+        CHECK(polygon.getHoleCount() == 0);
+        CHECK(polygon.getTexture() == nullptr);
+        CHECK(polygon.getFillColor() == sf::Color::White);
+        CHECK(polygon.getOutlineColor() == sf::Color::White);
+        CHECK(polygon.getOutlineThickness() == 0);
+        CHECK(polygon.getJoinStyle() == sf::PolygonShape::JoinStyle::Miter);
+        CHECK(polygon.getMiterLimit() == 4);
+        CHECK(polygon.getSmoothing() == 0);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect());
+    }
+
+    SUBCASE("Point count constructor")
+    {
+        const sf::PolygonShape polygon(15);
+        CHECK(polygon.getPointCount() == 15);
+        for (std::size_t i = 0; i < polygon.getPointCount(); ++i)
+            CHECK(polygon.getPoint(i) == sf::Vector2f(0, 0));
+    }
+
+    SUBCASE("Set point")
+    {
+        sf::PolygonShape polygon;
+        polygon.setPointCount(1);
+        polygon.setPoint(0, {3, 4});
+        CHECK(polygon.getPoint(0) == sf::Vector2f(3, 4));
+    }
+
+    SUBCASE("Holes")
+    {
+        sf::PolygonShape polygon;
+        polygon.addHole({{1, 1}, {2, 1}, {2, 2}});
+        CHECK(polygon.getHoleCount() == 1);
+        CHECK(polygon.getHole(0) == std::vector<sf::Vector2f>{{1, 1}, {2, 1}, {2, 2}});
+        polygon.clearHoles();
+        CHECK(polygon.getHoleCount() == 0);
+    }
+
+    SUBCASE("Miter limit")
+    {
+        sf::PolygonShape polygon;
+        polygon.setMiterLimit(0.5f);
+        CHECK(polygon.getMiterLimit() == 1);
+    }
+
+    SUBCASE("Concave polygon bounds")
+    {
+        sf::PolygonShape polygon(6);
+        polygon.setPoint(0, {0, 0});
+        polygon.setPoint(1, {10, 0});
+        polygon.setPoint(2, {10, 3});
+        polygon.setPoint(3, {3, 3});
+        polygon.setPoint(4, {3, 10});
+        polygon.setPoint(5, {0, 10});
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({0, 0}, {10, 10}));
+
+        polygon.setOutlineThickness(1);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({-1, -1}, {12, 12}));
+
+        polygon.setJoinStyle(sf::PolygonShape::JoinStyle::Bevel);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({-1, -1}, {12, 12}));
+
+        polygon.setSmoothing(1);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({-2, -2}, {14, 14}));
+    }
+}
@@ -0,0 +1,187 @@
+#include <SFML/Graphics/RenderCommandBuffer.hpp>
+#include <SFML/Graphics/RenderQueue.hpp>
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <type_traits>
+
+static_assert(std::is_copy_constructible_v<sf::RenderQueue>);
+static_assert(std::is_copy_assignable_v<sf::RenderQueue>);
+static_assert(std::is_move_constructible_v<sf::RenderQueue>);
+static_assert(std::is_move_assignable_v<sf::RenderQueue>);
+
+TEST_CASE("[Graphics] sf::RenderQueue")
+{
+    const std::array<sf::Vertex, 4> vertices = {sf::Vertex{{0, 0}},
+                                                sf::Vertex{{10, 0}},
+                                                sf::Vertex{{10, 10}},
+                                                sf::Vertex{{0, 10}}};
+
+    sf::RenderStates alpha;
+    alpha.blendMode = sf::BlendAlpha;
+    sf::RenderStates add;
+    add.blendMode = sf::BlendAdd;
+
+    SUBCASE("Construction")
+    {
+        const sf::RenderQueue queue;
+        CHECK(queue.getLayer() == 0);
+        CHECK(!queue.isLayerOrdered(0));
+        CHECK(queue.getCommandCount() == 0);
+    }
+
+    SUBCASE("Set/get layer")
+    {
+        sf::RenderQueue queue;
+        queue.setLayer(3);
+        CHECK(queue.getLayer() == 3);
+        queue.setLayerOrdered(3, true);
+        CHECK(queue.isLayerOrdered(3));
+        CHECK(!queue.isLayerOrdered(2));
+        queue.setLayerOrdered(3, false);
+        CHECK(!queue.isLayerOrdered(3));
+    }
+
+    SUBCASE("Draw vertices")
+    {
+        sf::RenderQueue queue;
+
+        SUBCASE("Lists")
+        {
+            queue.draw(vertices.data(), 3, sf::PrimitiveType::Triangles);
+            queue.draw(vertices.data(), 4, sf::PrimitiveType::Lines);
+            queue.draw(vertices.data(), 1, sf::PrimitiveType::Points);
+            CHECK(queue.getCommandCount() == 3);
+        }
+
+        SUBCASE("Strips and fans")
+        {
+            queue.draw(vertices.data(), 4, sf::PrimitiveType::TriangleStrip);
+            queue.draw(vertices.data(), 4, sf::PrimitiveType::TriangleFan);
+            queue.draw(vertices.data(), 2, sf::PrimitiveType::LineStrip);
+            CHECK(queue.getCommandCount() == 3);
+        }
+
+        SUBCASE("Too short strips and fans")
+        {
+            queue.draw(vertices.data(), 2, sf::PrimitiveType::TriangleStrip);
+            queue.draw(vertices.data(), 2, sf::PrimitiveType::TriangleFan);
+            queue.draw(vertices.data(), 1, sf::PrimitiveType::LineStrip);
+            CHECK(queue.getCommandCount() == 0);
+        }
+
+        SUBCASE("Empty input")
+        {
+            queue.draw(nullptr, 3, sf::PrimitiveType::Triangles);
+            queue.draw(vertices.data(), 0, sf::PrimitiveType::Triangles);
+            CHECK(queue.getCommandCount() == 0);
+        }
+
+        SUBCASE("Indexed vertices")
+        {
+            const std::array<std::uint32_t, 6> indices = {0, 1, 2, 0, 2, 3};
+            queue.draw(vertices.data(), vertices.size(), indices.data(), indices.size(), sf::PrimitiveType::Triangles);
+            queue.draw(vertices.data(), vertices.size(), nullptr, 0, sf::PrimitiveType::Triangles);
+            CHECK(queue.getCommandCount() == 1);
+        }
+
+        queue.clear();
+        CHECK(queue.getCommandCount() == 0);
+    }
+
+    SUBCASE("Append")
+    {
+        sf::RenderQueue first;
+        first.draw(vertices.data(), 3, sf::PrimitiveType::Triangles);
+
+        sf::RenderQueue second;
+        second.setLayer(1);
+        second.draw(vertices.data(), 4, sf::PrimitiveType::TriangleStrip);
+        second.draw(vertices.data(), 2, sf::PrimitiveType::Lines);
+
+        first.append(second);
+        CHECK(first.getCommandCount() == 3);
+        CHECK(first.getLayer() == 0);
+        CHECK(second.getCommandCount() == 2);
+    }
+
+    SUBCASE("Flush")
+    {
+        sf::RenderQueue         queue;
+        sf::RenderCommandBuffer buffer({100, 100});
+        const sf::RenderQueue&  recorded  = buffer.getQueue();
+        const sf::PrimitiveType triangles = sf::PrimitiveType::Triangles;
+
+        SUBCASE("Commands with the same states are merged")
+        {
+            for (int i = 0; i < 4; ++i)
+                queue.draw(vertices.data(), 3, triangles, alpha);
+
+            queue.flush(buffer);
+            CHECK(recorded.getCommandCount() == 1);
+            CHECK(queue.getCommandCount() == 0);
+        }
+
+        SUBCASE("Unordered layers are sorted by states")
+        {
+            for (int i = 0; i < 4; ++i)
+                queue.draw(vertices.data(), 3, triangles, (i % 2) ? add : alpha);
+
+            queue.flush(buffer);
+            CHECK(recorded.getCommandCount() == 2);
+        }
+
+        SUBCASE("Ordered layers keep the submission order")
+        {
+            queue.setLayerOrdered(0, true);
+            for (int i = 0; i < 4; ++i)
+                queue.draw(vertices.data(), 3, triangles, (i % 2) ? add : alpha);
+
+            queue.flush(buffer);
+            CHECK(recorded.getCommandCount() == 4);
+        }
+
+        SUBCASE("Primitive types are not merged")
+        {
+            queue.draw(vertices.data(), 3, triangles, alpha);
+            queue.draw(vertices.data(), 4, sf::PrimitiveType::Lines, alpha);
+            queue.draw(vertices.data(), 3, triangles, alpha);
+
+            queue.flush(buffer);
+            CHECK(recorded.getCommandCount() == 2);
+        }
+
+        SUBCASE("Layers are executed in increasing order")
+        {
+            queue.setLayer(1);
+            queue.draw(vertices.data(), 3, triangles, add);
+            queue.setLayer(0);
+            queue.draw(vertices.data(), 3, triangles, alpha);
+            queue.setLayer(2);
+            queue.draw(vertices.data(), 3, triangles, alpha);
+            queue.setLayer(0);
+            queue.draw(vertices.data(), 3, triangles, alpha);
+
+            // Layer 0 (merged), then layer 1, then layer 2: layer 2 can't be merged with layer 0
+            queue.flush(buffer);
+            CHECK(recorded.getCommandCount() == 3);
+        }
+
+        SUBCASE("Appended command buffers are merged")
+        {
+            sf::RenderCommandBuffer worker1({100, 100});
+            sf::RenderCommandBuffer worker2({100, 100});
+            worker1.draw(vertices.data(), 3, triangles, alpha);
+            worker2.draw(vertices.data(), 3, triangles, add);
+            worker2.draw(vertices.data(), 4, sf::PrimitiveType::TriangleFan, alpha);
+            CHECK(worker1.getQueue().getCommandCount() == 1);
+            CHECK(worker2.getQueue().getCommandCount() == 2);
+
+            queue.append(worker1.getQueue());
+            queue.append(worker2.getQueue());
+            queue.flush(buffer);
+            CHECK(recorded.getCommandCount() == 2);
+        }
+    }
+}
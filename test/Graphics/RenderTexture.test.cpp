@@ -1,8 +1,60 @@
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 
+#include <SFML/Window/Context.hpp>
+
+#include <doctest/doctest.h>
+
+#include <GraphicsUtil.hpp>
 #include <type_traits>
 
 static_assert(!std::is_copy_constructible_v<sf::RenderTexture>);
 static_assert(!std::is_copy_assignable_v<sf::RenderTexture>);
 static_assert(!std::is_nothrow_move_constructible_v<sf::RenderTexture>);
 static_assert(!std::is_nothrow_move_assignable_v<sf::RenderTexture>);
+
+TEST_CASE("[Graphics] sf::RenderTexture")
+{
+    SUBCASE("Alternate draws between targets of the same context")
+    {
+        // Targets drawn in turn in the same context, like a render texture and a window: on the
+        // core profile, each one must use its own vertex array object and streamed vertices
+        sf::ContextSettings settings;
+        settings.majorVersion   = 3;
+        settings.minorVersion   = 3;
+        settings.attributeFlags = sf::ContextSettings::Core;
+        sf::Context context(settings, {1, 1});
+
+        sf::RenderTexture first;
+        sf::RenderTexture second;
+        REQUIRE(first.create({8, 8}));
+        REQUIRE(second.create({8, 8}));
+
+        sf::RectangleShape left({4, 8});
+        left.setFillColor(sf::Color::Red);
+        sf::RectangleShape right({4, 8});
+        right.setPosition({4, 0});
+        right.setFillColor(sf::Color::Green);
+
+        first.clear();
+        second.clear();
+        for (int i = 0; i < 3; ++i)
+        {
+            first.draw(left);
+            second.draw(right);
+        }
+        first.draw(right);
+        second.clear();
+        second.draw(left);
+        first.display();
+        second.display();
+
+        const sf::Image firstImage  = first.getTexture().copyToImage();
+        const sf::Image secondImage = second.getTexture().copyToImage();
+        CHECK(firstImage.getPixel({1, 4}) == sf::Color::Red);
+        CHECK(firstImage.getPixel({6, 4}) == sf::Color::Green);
+        CHECK(secondImage.getPixel({1, 4}) == sf::Color::Red);
+        CHECK(secondImage.getPixel({6, 4}) == sf::Color::Black);
+    }
+}
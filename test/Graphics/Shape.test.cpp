@@ -3,6 +3,7 @@
 #include <doctest/doctest.h>
 
 #include <GraphicsUtil.hpp>
+#include <array>
 #include <type_traits>
 
 static_assert(!std::is_constructible_v<sf::Shape>);
@@ -93,6 +94,27 @@ TEST_CASE("[Graphics] sf::Shape")
         CHECK(triangleShape.getPoint(2) == sf::Vector2f(2, 2));
     }
 
+    SUBCASE("Get points")
+    {
+        const TriangleShape         triangleShape({2, 2});
+        std::array<sf::Vector2f, 3> points;
+        triangleShape.getPoints(points.data());
+        CHECK(points[0] == sf::Vector2f(1, 0));
+        CHECK(points[1] == sf::Vector2f(0, 2));
+        CHECK(points[2] == sf::Vector2f(2, 2));
+    }
+
+    SUBCASE("Outline thickness changes bounds")
+    {
+        TriangleShape triangleShape({2, 2});
+        CHECK(triangleShape.getLocalBounds() == sf::FloatRect({0, 0}, {2, 2}));
+        triangleShape.setOutlineThickness(1);
+        CHECK(triangleShape.getLocalBounds().left < 0);
+        CHECK(triangleShape.getLocalBounds().width > 2);
+        triangleShape.setOutlineThickness(0);
+        CHECK(triangleShape.getLocalBounds() == sf::FloatRect({0, 0}, {2, 2}));
+    }
+
     SUBCASE("Get bounds")
     {
         TriangleShape triangleShape({2, 3});
@@ -0,0 +1,8 @@
+#include <SFML/Graphics/TextureStreamer.hpp>
+
+#include <type_traits>
+
+static_assert(!std::is_copy_constructible_v<sf::TextureStreamer>);
+static_assert(!std::is_copy_assignable_v<sf::TextureStreamer>);
+static_assert(!std::is_move_constructible_v<sf::TextureStreamer>);
+static_assert(!std::is_move_assignable_v<sf::TextureStreamer>);
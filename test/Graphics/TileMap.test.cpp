@@ -0,0 +1,133 @@
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+
+#include <doctest/doctest.h>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_copy_constructible_v<sf::TileMap>);
+static_assert(std::is_copy_assignable_v<sf::TileMap>);
+static_assert(std::is_move_constructible_v<sf::TileMap>);
+static_assert(!std::is_nothrow_move_constructible_v<sf::TileMap>);
+static_assert(std::is_move_assignable_v<sf::TileMap>);
+static_assert(!std::is_nothrow_move_assignable_v<sf::TileMap>);
+
+TEST_CASE("[Graphics] sf::TileMap")
+{
+    const sf::Texture tileset;
+    sf::TileMap       map(tileset, {16, 8}, {5, 3}, 2);
+
+    SUBCASE("Construction")
+    {
+        CHECK(&map.getTileset() == &tileset);
+        CHECK(map.getTileSize() == sf::Vector2u(16, 8));
+        CHECK(map.getSize() == sf::Vector2u(5, 3));
+        for (unsigned int y = 0; y < 3; ++y)
+            for (unsigned int x = 0; x < 5; ++x)
+                CHECK(map.getTile({x, y}) == sf::TileMap::EmptyTile);
+    }
+
+    SUBCASE("Set/get tile")
+    {
+        map.setTile({4, 2}, 7);
+        map.setTile({0, 1}, 3);
+        CHECK(map.getTile({4, 2}) == 7);
+        CHECK(map.getTile({0, 1}) == 3);
+        CHECK(map.getTile({1, 0}) == sf::TileMap::EmptyTile);
+
+        map.setTile({4, 2}, sf::TileMap::EmptyTile);
+        CHECK(map.getTile({4, 2}) == sf::TileMap::EmptyTile);
+    }
+
+    SUBCASE("Set tiles")
+    {
+        std::vector<sf::TileMap::TileId> tiles(15);
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+            tiles[i] = static_cast<sf::TileMap::TileId>(i * 2);
+
+        map.setTiles(tiles.data());
+        CHECK(map.getTile({0, 0}) == 0);
+        CHECK(map.getTile({4, 0}) == 8);
+        CHECK(map.getTile({0, 1}) == 10);
+        CHECK(map.getTile({3, 2}) == 26);
+        CHECK(map.getTile({4, 2}) == 28);
+    }
+
+    SUBCASE("Animation")
+    {
+        map.setTile({1, 1}, 4);
+
+        SUBCASE("Tiles are not animated by default")
+        {
+            CHECK(map.getDisplayedTile(4) == 4);
+            map.update(sf::seconds(1));
+            CHECK(map.getDisplayedTile(4) == 4);
+        }
+
+        SUBCASE("Frames are selected from the elapsed time")
+        {
+            map.setAnimation(4, {4, 9, 2}, sf::milliseconds(100));
+            CHECK(map.getDisplayedTile(4) == 4);
+            CHECK(map.getDisplayedTile(9) == 9);
+
+            map.update(sf::milliseconds(50));
+            CHECK(map.getDisplayedTile(4) == 4);
+            map.update(sf::milliseconds(50));
+            CHECK(map.getDisplayedTile(4) == 9);
+            map.update(sf::milliseconds(150));
+            CHECK(map.getDisplayedTile(4) == 2);
+
+            // 350ms: the animation loops back to its first frame
+            map.update(sf::milliseconds(100));
+            CHECK(map.getDisplayedTile(4) == 4);
+
+            // Several loops in a single update
+            map.update(sf::milliseconds(750));
+            CHECK(map.getDisplayedTile(4) == 2);
+
+            // The tile identifiers of the cells don't change
+            CHECK(map.getTile({1, 1}) == 4);
+        }
+
+        SUBCASE("Setting the animation again restarts it")
+        {
+            map.setAnimation(4, {4, 9, 2}, sf::milliseconds(100));
+            map.update(sf::milliseconds(150));
+            CHECK(map.getDisplayedTile(4) == 9);
+
+            map.setAnimation(4, {5, 6}, sf::milliseconds(100));
+            CHECK(map.getDisplayedTile(4) == 5);
+            map.update(sf::milliseconds(100));
+            CHECK(map.getDisplayedTile(4) == 6);
+        }
+
+        SUBCASE("An empty list of frames stops the animation")
+        {
+            map.setAnimation(4, {4, 9, 2}, sf::milliseconds(100));
+            map.update(sf::milliseconds(150));
+            map.setAnimation(4, {}, sf::milliseconds(100));
+            CHECK(map.getDisplayedTile(4) == 4);
+            map.update(sf::milliseconds(150));
+            CHECK(map.getDisplayedTile(4) == 4);
+        }
+
+        SUBCASE("Animations with a zero frame duration don't advance")
+        {
+            map.setAnimation(4, {9, 2}, sf::Time::Zero);
+            map.update(sf::seconds(1));
+            CHECK(map.getDisplayedTile(4) == 9);
+        }
+    }
+
+    SUBCASE("Bounds")
+    {
+        CHECK(map.getLocalBounds() == sf::FloatRect({0, 0}, {80, 24}));
+
+        map.setPosition({10, 20});
+        map.setScale({2, 0.5f});
+        CHECK(map.getLocalBounds() == sf::FloatRect({0, 0}, {80, 24}));
+        CHECK(map.getGlobalBounds() == sf::FloatRect({10, 20}, {160, 12}));
+    }
+}
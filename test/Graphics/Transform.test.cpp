@@ -1,9 +1,11 @@
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Angle.hpp>
 
 #include <doctest/doctest.h>
 
 #include <GraphicsUtil.hpp>
+#include <array>
 #include <cassert>
 #include <type_traits>
 #include <vector>
@@ -12,6 +14,7 @@ static_assert(std::is_copy_constructible_v<sf::Transform>);
 static_assert(std::is_copy_assignable_v<sf::Transform>);
 static_assert(std::is_nothrow_move_constructible_v<sf::Transform>);
 static_assert(std::is_nothrow_move_assignable_v<sf::Transform>);
+static_assert(sizeof(sf::Transform) == 6 * sizeof(float));
 
 // Use StringMaker to avoid opening namespace std
 namespace doctest
@@ -42,17 +45,19 @@ TEST_CASE("[Graphics] sf::Transform")
 
         SUBCASE("3x3 matrix constructor")
         {
-            const sf::Transform      transform(10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f, 17.0f, 18.0f);
-            const std::vector<float> matrix(transform.getMatrix(), transform.getMatrix() + 16);
+            const sf::Transform         transform(10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 0.0f, 0.0f, 1.0f);
+            const std::array<float, 16> array = transform.getMatrix();
+            const std::vector<float>    matrix(array.begin(), array.end());
             CHECK(
                 matrix ==
-                std::vector<float>{10.0f, 13.0f, 0.0f, 16.0f, 11.0f, 14.0f, 0.0f, 17.0f, 0.0f, 0.0f, 1.0f, 0.0f, 12.0f, 15.0f, 0.0f, 18.0f});
+                std::vector<float>{10.0f, 13.0f, 0.0f, 0.0f, 11.0f, 14.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 12.0f, 15.0f, 0.0f, 1.0f});
         }
     }
 
     SUBCASE("Identity matrix")
     {
-        const std::vector<float> matrix(sf::Transform::Identity.getMatrix(), sf::Transform::Identity.getMatrix() + 16);
+        const std::array<float, 16> array = sf::Transform::Identity.getMatrix();
+        const std::vector<float>    matrix(array.begin(), array.end());
         CHECK(matrix ==
               std::vector<float>{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f});
     }
@@ -60,9 +65,9 @@ TEST_CASE("[Graphics] sf::Transform")
     SUBCASE("getInverse()")
     {
         CHECK(sf::Transform::Identity.getInverse() == sf::Transform::Identity);
-        CHECK(sf::Transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f).getInverse() == sf::Transform::Identity);
-        CHECK(sf::Transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f).getInverse() ==
-              sf::Transform(0.375f, -0.5f, 0.875f, -1.0f, 1.0f, -1.0f, 0.875f, -0.5f, 0.375f));
+        CHECK(sf::Transform(1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 6.0f, 0.0f, 0.0f, 1.0f).getInverse() == sf::Transform::Identity);
+        CHECK(sf::Transform(2.0f, 0.0f, 4.0f, 0.0f, 4.0f, 8.0f, 0.0f, 0.0f, 1.0f).getInverse() ==
+              sf::Transform(0.5f, 0.0f, -2.0f, 0.0f, 0.25f, -2.0f, 0.0f, 0.0f, 1.0f));
     }
 
     SUBCASE("transformPoint()")
@@ -75,12 +80,38 @@ TEST_CASE("[Graphics] sf::Transform")
         CHECK(sf::Transform::Identity.transformPoint({1.0f, 1.0f}) == sf::Vector2f(1.0f, 1.0f));
         CHECK(sf::Transform::Identity.transformPoint({10.0f, 10.0f}) == sf::Vector2f(10.0f, 10.0f));
 
-        const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+        const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f);
         CHECK(transform.transformPoint({-1.0f, -1.0f}) == sf::Vector2f(0.0f, -5.0f));
         CHECK(transform.transformPoint({0.0f, 0.0f}) == sf::Vector2f(3.0f, 4.0f));
         CHECK(transform.transformPoint({1.0f, 1.0f}) == sf::Vector2f(6.0f, 13.0f));
     }
 
+    SUBCASE("transformPoints()")
+    {
+        const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f);
+
+        std::vector<sf::Vector2f> points;
+        for (int i = 0; i < 7; ++i)
+            points.emplace_back(static_cast<float>(i) - 3.0f, static_cast<float>(i * i));
+
+        std::vector<sf::Vector2f> result(points.size());
+        transform.transformPoints(points.data(), points.size(), result.data());
+        for (std::size_t i = 0; i < points.size(); ++i)
+            CHECK(result[i] == transform.transformPoint(points[i]));
+
+        std::vector<sf::Vertex> vertices;
+        for (const sf::Vector2f& point : points)
+            vertices.emplace_back(point, sf::Color::Red, point);
+
+        transform.transformPoints(vertices.data(), vertices.size(), vertices.data());
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            CHECK(vertices[i].position == transform.transformPoint(points[i]));
+            CHECK(vertices[i].color == sf::Color::Red);
+            CHECK(vertices[i].texCoords == points[i]);
+        }
+    }
+
     SUBCASE("transformRect()")
     {
         CHECK(sf::Transform::Identity.transformRect({{-200.0f, -200.0f}, {-100.0f, -100.0f}}) ==
@@ -90,7 +121,7 @@ TEST_CASE("[Graphics] sf::Transform")
         CHECK(sf::Transform::Identity.transformRect({{100.0f, 100.0f}, {200.0f, 200.0f}}) ==
               sf::FloatRect({100.0f, 100.0f}, {200.0f, 200.0f}));
 
-        const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+        const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f);
         CHECK(transform.transformRect({{-100.0f, -100.0f}, {200.0f, 200.0f}}) ==
               sf::FloatRect({-297.0f, -896.0f}, {600.0f, 1800.0f}));
         CHECK(transform.transformRect({{0.0f, 0.0f}, {0.0f, 0.0f}}) == sf::FloatRect({3.0f, 4.0f}, {0.0f, 0.0f}));
@@ -104,19 +135,19 @@ TEST_CASE("[Graphics] sf::Transform")
         CHECK(identity.combine(sf::Transform::Identity) == sf::Transform::Identity);
         CHECK(identity.combine(sf::Transform::Identity).combine(sf::Transform::Identity) == sf::Transform::Identity);
 
-        sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+        sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f);
         CHECK(identity.combine(transform) == transform);
         CHECK(transform.combine(sf::Transform::Identity) == transform);
-        CHECK(transform.combine(transform) == sf::Transform(18.0f, 18.0f, 14.0f, 36.0f, 41.0f, 36.0f, 14.0f, 18.0f, 18.0f));
-        CHECK(transform.combine(sf::Transform(10.0f, 2.0f, 3.0f, 4.0f, 50.0f, 40.0f, 30.0f, 20.0f, 10.0f)) ==
-              sf::Transform(672.0f, 1216.0f, 914.0f, 1604.0f, 2842.0f, 2108.0f, 752.0f, 1288.0f, 942.0f));
+        CHECK(transform.combine(transform) == sf::Transform(9.0f, 12.0f, 14.0f, 24.0f, 33.0f, 36.0f, 0.0f, 0.0f, 1.0f));
+        CHECK(transform.combine(sf::Transform(10.0f, 2.0f, 3.0f, 4.0f, 50.0f, 40.0f, 0.0f, 0.0f, 1.0f)) ==
+              sf::Transform(138.0f, 618.0f, 521.0f, 372.0f, 1698.0f, 1428.0f, 0.0f, 0.0f, 1.0f));
     }
 
     SUBCASE("translate()")
     {
-        sf::Transform transform(9, 8, 7, 6, 5, 4, 3, 2, 1);
-        CHECK(transform.translate({10.0f, 20.0f}) == sf::Transform(9, 8, 257, 6, 5, 164, 3, 2, 71));
-        CHECK(transform.translate({10.0f, 20.0f}) == sf::Transform(9, 8, 507, 6, 5, 324, 3, 2, 141));
+        sf::Transform transform(9, 8, 7, 6, 5, 4, 0, 0, 1);
+        CHECK(transform.translate({10.0f, 20.0f}) == sf::Transform(9, 8, 257, 6, 5, 164, 0, 0, 1));
+        CHECK(transform.translate({10.0f, 20.0f}) == sf::Transform(9, 8, 507, 6, 5, 324, 0, 0, 1));
     }
 
     SUBCASE("rotate()")
@@ -140,17 +171,17 @@ TEST_CASE("[Graphics] sf::Transform")
     {
         SUBCASE("About origin")
         {
-            sf::Transform transform(1, 2, 3, 4, 5, 4, 3, 2, 1);
-            CHECK(transform.scale({2.0f, 4.0f}) == sf::Transform(2, 8, 3, 8, 20, 4, 6, 8, 1));
+            sf::Transform transform(1, 2, 3, 4, 5, 4, 0, 0, 1);
+            CHECK(transform.scale({2.0f, 4.0f}) == sf::Transform(2, 8, 3, 8, 20, 4, 0, 0, 1));
             CHECK(transform.scale({0.0f, 0.0f}) == sf::Transform(0, 0, 3, 0, 0, 4, 0, 0, 1));
             CHECK(transform.scale({10.0f, 10.0f}) == sf::Transform(0, 0, 3, 0, 0, 4, 0, 0, 1));
         }
 
         SUBCASE("About custom point")
         {
-            sf::Transform transform(1, 2, 3, 4, 5, 4, 3, 2, 1);
-            CHECK(transform.scale({1.0f, 2.0f}, {1.0f, 0.0f}) == sf::Transform(1, 4, 3, 4, 10, 4, 3, 4, 1));
-            CHECK(transform.scale({0.0f, 0.0f}, {1.0f, 0.0f}) == sf::Transform(0, 0, 4, 0, 0, 8, 0, 0, 4));
+            sf::Transform transform(1, 2, 3, 4, 5, 4, 0, 0, 1);
+            CHECK(transform.scale({1.0f, 2.0f}, {1.0f, 0.0f}) == sf::Transform(1, 4, 3, 4, 10, 4, 0, 0, 1));
+            CHECK(transform.scale({0.0f, 0.0f}, {1.0f, 0.0f}) == sf::Transform(0, 0, 4, 0, 0, 8, 0, 0, 1));
         }
     }
 
@@ -161,23 +192,23 @@ TEST_CASE("[Graphics] sf::Transform")
             CHECK(sf::Transform::Identity * sf::Transform::Identity == sf::Transform::Identity);
             CHECK(sf::Transform::Identity * sf::Transform::Identity * sf::Transform::Identity == sf::Transform::Identity);
 
-            const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+            const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f);
             CHECK(sf::Transform::Identity * transform == transform);
             CHECK(transform * sf::Transform::Identity == transform);
-            CHECK(transform * transform == sf::Transform(18.0f, 18.0f, 14.0f, 36.0f, 41.0f, 36.0f, 14.0f, 18.0f, 18.0f));
-            CHECK(transform * sf::Transform(10.0f, 2.0f, 3.0f, 4.0f, 50.0f, 40.0f, 30.0f, 20.0f, 10.0f) ==
-                  sf::Transform(108.0f, 162.0f, 113.0f, 180.0f, 338.0f, 252.0f, 68.0f, 126.0f, 99.0f));
+            CHECK(transform * transform == sf::Transform(9.0f, 12.0f, 14.0f, 24.0f, 33.0f, 36.0f, 0.0f, 0.0f, 1.0f));
+            CHECK(transform * sf::Transform(10.0f, 2.0f, 3.0f, 4.0f, 50.0f, 40.0f, 0.0f, 0.0f, 1.0f) ==
+                  sf::Transform(18.0f, 102.0f, 86.0f, 60.0f, 258.0f, 216.0f, 0.0f, 0.0f, 1.0f));
         }
 
         SUBCASE("operator*=")
         {
-            sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+            sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f);
             transform *= sf::Transform::Identity;
-            CHECK(transform == sf::Transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f));
+            CHECK(transform == sf::Transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f));
             transform *= transform;
-            CHECK(transform == sf::Transform(18.0f, 18.0f, 14.0f, 36.0f, 41.0f, 36.0f, 14.0f, 18.0f, 18.0f));
-            transform *= sf::Transform(10.0f, 2.0f, 3.0f, 4.0f, 50.0f, 40.0f, 30.0f, 20.0f, 10.0f);
-            CHECK(transform == sf::Transform(672.0f, 1216.0f, 914.0f, 1604.0f, 2842.0f, 2108.0f, 752.0f, 1288.0f, 942.0f));
+            CHECK(transform == sf::Transform(9.0f, 12.0f, 14.0f, 24.0f, 33.0f, 36.0f, 0.0f, 0.0f, 1.0f));
+            transform *= sf::Transform(10.0f, 2.0f, 3.0f, 4.0f, 50.0f, 40.0f, 0.0f, 0.0f, 1.0f);
+            CHECK(transform == sf::Transform(138.0f, 618.0f, 521.0f, 372.0f, 1698.0f, 1428.0f, 0.0f, 0.0f, 1.0f));
         }
 
         SUBCASE("operator* with vector")
@@ -190,7 +221,7 @@ TEST_CASE("[Graphics] sf::Transform")
             CHECK(sf::Transform::Identity * sf::Vector2f(1.0f, 1.0f) == sf::Vector2f(1.0f, 1.0f));
             CHECK(sf::Transform::Identity * sf::Vector2f(10.0f, 10.0f) == sf::Vector2f(10.0f, 10.0f));
 
-            const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+            const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 0.0f, 0.0f, 1.0f);
             CHECK(transform * sf::Vector2f(-1.0f, -1.0f) == sf::Vector2f(0.0f, -5.0f));
             CHECK(transform * sf::Vector2f(0.0f, 0.0f) == sf::Vector2f(3.0f, 4.0f));
             CHECK(transform * sf::Vector2f(1.0f, 1.0f) == sf::Vector2f(6.0f, 13.0f));
@@ -200,32 +231,29 @@ TEST_CASE("[Graphics] sf::Transform")
         {
             CHECK(sf::Transform::Identity == sf::Transform::Identity);
             CHECK(sf::Transform() == sf::Transform());
-            CHECK(sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0) == sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f) ==
-                  sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f));
-            CHECK(sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f) ==
-                  sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f));
+            CHECK(sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1) == sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
+            CHECK(sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0f, 0.0f, 1.0f) ==
+                  sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0f, 0.0f, 1.0f));
+            CHECK(sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 0.0f, 0.0f, 1.0f) ==
+                  sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 0.0f, 0.0f, 1.0f));
         }
 
         SUBCASE("operator!=")
         {
             CHECK_FALSE(sf::Transform::Identity != sf::Transform::Identity);
             CHECK_FALSE(sf::Transform() != sf::Transform());
-            CHECK_FALSE(sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK_FALSE(sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f) !=
-                        sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f));
-            CHECK_FALSE(sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f) !=
-                        sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f));
-
-            CHECK(sf::Transform(1, 0, 0, 0, 0, 0, 0, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 1, 0, 0, 0, 0, 0, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 0, 1, 0, 0, 0, 0, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 0, 0, 1, 0, 0, 0, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 0, 0, 0, 1, 0, 0, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 0, 0, 0, 0, 1, 0, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 0, 0, 0, 0, 0, 1, 0, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 0, 0, 0, 0, 0, 0, 1, 0) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
-            CHECK(sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 0));
+            CHECK_FALSE(sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
+            CHECK_FALSE(sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0f, 0.0f, 1.0f) !=
+                        sf::Transform(0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0001f, 0.0f, 0.0f, 1.0f));
+            CHECK_FALSE(sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 0.0f, 0.0f, 1.0f) !=
+                        sf::Transform(1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 1000.0f, 0.0f, 0.0f, 1.0f));
+
+            CHECK(sf::Transform(1, 0, 0, 0, 0, 0, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
+            CHECK(sf::Transform(0, 1, 0, 0, 0, 0, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
+            CHECK(sf::Transform(0, 0, 1, 0, 0, 0, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
+            CHECK(sf::Transform(0, 0, 0, 1, 0, 0, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
+            CHECK(sf::Transform(0, 0, 0, 0, 1, 0, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
+            CHECK(sf::Transform(0, 0, 0, 0, 0, 1, 0, 0, 1) != sf::Transform(0, 0, 0, 0, 0, 0, 0, 0, 1));
         }
     }
 }
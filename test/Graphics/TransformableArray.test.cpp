@@ -0,0 +1,131 @@
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/TransformableArray.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <doctest/doctest.h>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_copy_constructible_v<sf::TransformableArray>);
+static_assert(std::is_copy_assignable_v<sf::TransformableArray>);
+static_assert(std::is_nothrow_move_constructible_v<sf::TransformableArray>);
+static_assert(std::is_nothrow_move_assignable_v<sf::TransformableArray>);
+
+TEST_CASE("[Graphics] sf::TransformableArray")
+{
+    SUBCASE("Construction")
+    {
+        SUBCASE("Default constructor")
+        {
+            const sf::TransformableArray array;
+            CHECK(array.getSize() == 0);
+        }
+
+        SUBCASE("Count constructor")
+        {
+            const sf::TransformableArray array(3);
+            CHECK(array.getSize() == 3);
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                CHECK(array.getPositions()[i] == sf::Vector2f(0, 0));
+                CHECK(array.getRotations()[i] == sf::Angle::Zero);
+                CHECK(array.getScales()[i] == sf::Vector2f(1, 1));
+                CHECK(array.getOrigins()[i] == sf::Vector2f(0, 0));
+            }
+        }
+    }
+
+    SUBCASE("Add and remove")
+    {
+        sf::TransformableArray array;
+        CHECK(array.add({1, 2}) == 0);
+        CHECK(array.add({3, 4}, sf::degrees(90), {5, 6}, {7, 8}) == 1);
+        CHECK(array.add({9, 10}) == 2);
+        CHECK(array.getSize() == 3);
+        CHECK(array.getPositions()[1] == sf::Vector2f(3, 4));
+        CHECK(array.getRotations()[1] == sf::degrees(90));
+        CHECK(array.getScales()[1] == sf::Vector2f(5, 6));
+        CHECK(array.getOrigins()[1] == sf::Vector2f(7, 8));
+
+        array.swapRemove(0);
+        CHECK(array.getSize() == 2);
+        CHECK(array.getPositions()[0] == sf::Vector2f(9, 10));
+        CHECK(array.getPositions()[1] == sf::Vector2f(3, 4));
+
+        array.resize(4);
+        CHECK(array.getSize() == 4);
+        CHECK(array.getScales()[3] == sf::Vector2f(1, 1));
+    }
+
+    SUBCASE("computeTransforms()")
+    {
+        sf::TransformableArray array;
+        array.add({3, 4}, sf::degrees(30), {5, 6}, {7, 8});
+        array.add({-1, 2}, sf::degrees(200), {0.5f, 2}, {1, 1});
+
+        sf::Transformable transformable;
+        transformable.setPosition({-1, 2});
+        transformable.setRotation(sf::degrees(200));
+        transformable.setScale({0.5f, 2});
+        transformable.setOrigin({1, 1});
+
+        sf::Transform transform;
+        array.computeTransforms(1, 1, &transform);
+
+        CHECK(transform == Approx(transformable.getTransform()));
+    }
+
+    SUBCASE("computeTransforms() of many objects")
+    {
+        sf::TransformableArray array;
+        for (int i = 0; i < 1000; ++i)
+            array.add({static_cast<float>(i), 2}, sf::degrees(static_cast<float>(i)), {1, 0.5f}, {3, 4});
+
+        std::vector<sf::Transform> transforms(999);
+        array.computeTransforms(1, transforms.size(), transforms.data());
+
+        sf::Transformable transformable;
+        transformable.setScale({1, 0.5f});
+        transformable.setOrigin({3, 4});
+        for (int i : {1, 255, 256, 257, 600, 999})
+        {
+            transformable.setPosition({static_cast<float>(i), 2});
+            transformable.setRotation(sf::degrees(static_cast<float>(i)));
+            CHECK(transforms[static_cast<std::size_t>(i) - 1] == Approx(transformable.getTransform()));
+        }
+    }
+
+    SUBCASE("computeQuads()")
+    {
+        sf::TransformableArray array;
+        array.add({10, 20});
+        array.add({0, 0}, sf::degrees(90), {2, 2});
+
+        const sf::IntRect       rects[]  = {{{0, 0}, {4, 8}}, {{4, 0}, {4, 8}}};
+        const sf::Color         colors[] = {sf::Color::Red, sf::Color::Blue};
+        std::vector<sf::Vertex> vertices(8);
+        array.computeQuads(0, 2, rects, colors, vertices.data());
+
+        CHECK(vertices[0].position == sf::Vector2f(10, 20));
+        CHECK(vertices[1].position == sf::Vector2f(10, 28));
+        CHECK(vertices[2].position == sf::Vector2f(14, 20));
+        CHECK(vertices[3].position == sf::Vector2f(14, 28));
+        CHECK(vertices[0].color == sf::Color::Red);
+        CHECK(vertices[0].texCoords == sf::Vector2f(0, 0));
+        CHECK(vertices[3].texCoords == sf::Vector2f(4, 8));
+
+        CHECK(vertices[4].position == Approx(sf::Vector2f(0, 0)));
+        CHECK(vertices[5].position == Approx(sf::Vector2f(-16, 0)));
+        CHECK(vertices[6].position == Approx(sf::Vector2f(0, 8)));
+        CHECK(vertices[7].position == Approx(sf::Vector2f(-16, 8)));
+        CHECK(vertices[4].color == sf::Color::Blue);
+        CHECK(vertices[4].texCoords == sf::Vector2f(4, 0));
+
+        array.computeQuads(0, 1, rects, nullptr, vertices.data());
+        CHECK(vertices[0].color == sf::Color::White);
+    }
+}
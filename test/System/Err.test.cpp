@@ -2,7 +2,10 @@
 
 #include <doctest/doctest.h>
 
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 TEST_CASE("[System] sf::err")
 {
@@ -38,4 +41,83 @@ TEST_CASE("[System] sf::err")
         sf::err().rdbuf(defaultStreamBuffer);
         CHECK(sf::err().rdbuf() == defaultStreamBuffer);
     }
+
+    SUBCASE("Log sink")
+    {
+        // Messages of the previous subcases must not reach the new sink
+        sf::Log::flush();
+
+        std::mutex                   mutex;
+        std::vector<sf::Log::Record> records;
+        sf::Log::setSink(
+            [&](const sf::Log::Record& record)
+            {
+                const std::scoped_lock lock(mutex);
+                records.push_back(record);
+            });
+
+        SUBCASE("Lines become records")
+        {
+            sf::err() << "First " << 1 << std::endl;
+            sf::err(sf::Log::Level::Warning) << "Second\nThird" << std::endl;
+            sf::Log::flush();
+
+            REQUIRE(records.size() == 3);
+            CHECK(records[0].level == sf::Log::Level::Error);
+            CHECK(records[0].message == "First 1");
+            CHECK(records[0].count == 1);
+            CHECK(records[1].level == sf::Log::Level::Warning);
+            CHECK(records[1].message == "Second");
+            CHECK(records[2].message == "Third");
+        }
+
+        SUBCASE("Repeated messages are deduplicated")
+        {
+            for (int i = 0; i < 100; ++i)
+                sf::err() << "Same message" << std::endl;
+            sf::Log::flush();
+
+            REQUIRE(records.size() == 2);
+            CHECK(records[0].message == "Same message");
+            CHECK(records[0].count == 1);
+            CHECK(records[1].message == "Same message");
+            CHECK(records[1].count == 99);
+        }
+
+        SUBCASE("Partial lines are sent when their thread exits")
+        {
+            std::thread([] { sf::err(sf::Log::Level::Warning) << "Partial line"; }).join();
+            sf::Log::flush();
+
+            REQUIRE(records.size() == 1);
+            CHECK(records[0].level == sf::Log::Level::Warning);
+            CHECK(records[0].message == "Partial line");
+        }
+
+        SUBCASE("Minimum level")
+        {
+            sf::Log::setMinimumLevel(sf::Log::Level::Error);
+            sf::err(sf::Log::Level::Info) << "Discarded" << std::endl;
+            sf::err() << "Delivered" << std::endl;
+            sf::Log::flush();
+            sf::Log::setMinimumLevel(sf::Log::Level::Info);
+
+            REQUIRE(records.size() == 1);
+            CHECK(records[0].message == "Delivered");
+        }
+
+        SUBCASE("Disabled")
+        {
+            sf::Log::setSink({});
+            sf::err() << "Discarded" << std::endl;
+            CHECK(sf::err().bad());
+            sf::Log::flush();
+
+            CHECK(records.empty());
+        }
+
+        // Restore the default output
+        sf::Log::flush();
+        sf::Log::setSink(sf::Log::writeToStandardError);
+    }
 }
@@ -0,0 +1,11 @@
+// Writes a partial line to sf::err and exits: the line must be delivered
+// when the program exits, after the thread-local objects are destroyed.
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+
+int main()
+{
+    sf::err() << "Partial line written at exit, longer than the small string buffer";
+}
@@ -0,0 +1,40 @@
+#include <SFML/System/Tracing.hpp>
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+TEST_CASE("[System] sf::Tracing")
+{
+    SUBCASE("isEnabled()")
+    {
+#ifdef SFML_ENABLE_TRACING
+        CHECK(sf::Tracing::isEnabled());
+#else
+        CHECK(!sf::Tracing::isEnabled());
+#endif
+    }
+
+    SUBCASE("flush()")
+    {
+        // Nothing in the system module records events on this thread
+        std::size_t eventCount = 0;
+        sf::Tracing::flush([&](const sf::Tracing::Event&) { ++eventCount; });
+        CHECK(eventCount == 0);
+    }
+
+    SUBCASE("flushToFile()")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "sfmltrace.json";
+        REQUIRE(sf::Tracing::flushToFile(path));
+
+        std::ostringstream contents;
+        contents << std::ifstream(path).rdbuf();
+        CHECK(contents.str() == "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\n");
+
+        std::filesystem::remove(path);
+    }
+}